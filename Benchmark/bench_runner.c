@@ -0,0 +1,444 @@
+/******************************************************************************
+ *
+ * Module: BENCHMARK
+ *
+ * File Name: bench_runner.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Cycle-count benchmark of the firmware running under simavr.
+ *              The real Mini_Project3.elf is executed instruction by instruction,
+ *              every call to a profiled function is timed from its entry until
+ *              the stack pointer shows it returned, and the mean cycles per call
+ *              are checked against the stored baseline.
+ *
+ * Usage: bench_runner [options] Mini_Project3.elf
+ *        -b FILE   baseline file to check against (or to write with -u)
+ *        -u        update the baseline file with the measured values
+ *        -t PCT    allowed regression in percent before failing (default 2)
+ *        -n LOOPS  number of full loop iterations to time (default 8)
+ *        -w LOOPS  loop iterations skipped first while the LCD is brought up (default 64)
+ *        -m MV     LM35 output voltage fed to ADC channel 2 in mV (default 500)
+ *
+ *******************************************************************************/
+
+#include <elf.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+#include <simavr/sim_io.h>
+#include <simavr/avr_adc.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define BENCH_MCU_NAME                  "atmega32"
+#define BENCH_MCU_FREQUENCY             1000000UL
+#define BENCH_LM35_ADC_IRQ              ADC_IRQ_ADC2
+
+/* The PWM driver entry of DcMotor_rotate, the boot is timed from the reset until its first call */
+#define BENCH_PWM_NAME                  "PWM_Timer0_start"
+#define BENCH_BOOT_NAME                 "reset_to_first_pwm"
+
+/* The function entered once per superloop iteration, used to time a full loop */
+#define BENCH_LOOP_ANCHOR               "Watchdog_service"
+#define BENCH_LOOP_NAME                 "loop_iteration"
+
+/* Safety limit so a firmware which never reaches the anchor cannot hang the run */
+#define BENCH_MAX_CYCLES                (200UL * BENCH_MCU_FREQUENCY)
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	const char * name;
+	uint32_t entry;                    /* Byte address of the function in flash */
+	int active;
+	uint16_t entrySp;
+	avr_cycle_count_t startCycle;
+	uint32_t calls;
+	uint64_t totalCycles;
+	uint64_t minCycles;
+	uint64_t maxCycles;
+} Bench_FunctionType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static Bench_FunctionType g_functions[] = {
+	{ .name = "ADC_readChannel" },
+	{ .name = "Sensor_update" },
+	{ .name = "LM_35_read" },              /* Static, the read of the LM35 sensor interface */
+	{ .name = BENCH_PWM_NAME },
+	{ .name = "LCD_sendData" },
+	{ .name = "GPIO_writePin" },
+};
+#define BENCH_NUM_OF_FUNCTIONS          (sizeof(g_functions) / sizeof(g_functions[0]))
+
+static Bench_FunctionType g_loop = { .name = BENCH_LOOP_NAME };
+static Bench_FunctionType g_boot = { .name = BENCH_BOOT_NAME };
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Look up the address of a function symbol in the .symtab of an AVR ELF file.
+ * Returns 0 if the symbol is not found.
+ */
+static uint32_t Bench_findSymbol (const uint8_t * image, size_t size, const char * name)
+{
+	const Elf32_Ehdr * ehdr = (const Elf32_Ehdr *)image;
+	const Elf32_Shdr * shdrs;
+	uint16_t i;
+
+	if ((size < sizeof(Elf32_Ehdr)) || (memcmp (ehdr->e_ident, ELFMAG, SELFMAG) != 0) ||
+			(ehdr->e_ident[EI_CLASS] != ELFCLASS32) || (ehdr->e_shoff + (size_t)ehdr->e_shnum * sizeof(Elf32_Shdr) > size))
+	{
+		return 0;
+	}
+	shdrs = (const Elf32_Shdr *)(image + ehdr->e_shoff);
+
+	for (i = 0; i < ehdr->e_shnum; i++)
+	{
+		const Elf32_Shdr * symtab = &shdrs[i];
+		const Elf32_Shdr * strtab;
+		const Elf32_Sym * syms;
+		uint32_t count, j;
+
+		if ((symtab->sh_type != SHT_SYMTAB) || (symtab->sh_link >= ehdr->e_shnum))
+		{
+			continue;
+		}
+		strtab = &shdrs[symtab->sh_link];
+		syms = (const Elf32_Sym *)(image + symtab->sh_offset);
+		count = symtab->sh_size / sizeof(Elf32_Sym);
+
+		for (j = 0; j < count; j++)
+		{
+			if ((ELF32_ST_TYPE (syms[j].st_info) == STT_FUNC) && (syms[j].st_name < strtab->sh_size) &&
+					(strcmp ((const char *)(image + strtab->sh_offset + syms[j].st_name), name) == 0))
+			{
+				return syms[j].st_value;
+			}
+		}
+	}
+	return 0;
+}
+
+/*
+ * Description :
+ * Read the ELF file and resolve the entry address of every profiled function.
+ */
+static int Bench_resolveSymbols (const char * elfPath)
+{
+	FILE * file = fopen (elfPath, "rb");
+	uint8_t * image;
+	long size;
+	size_t i;
+	int ok = 1;
+
+	if (file == NULL)
+	{
+		perror (elfPath);
+		return 0;
+	}
+	fseek (file, 0, SEEK_END);
+	size = ftell (file);
+	fseek (file, 0, SEEK_SET);
+	image = malloc ((size_t)size);
+	if ((image == NULL) || (fread (image, 1, (size_t)size, file) != (size_t)size))
+	{
+		fprintf (stderr, "%s: cannot read the ELF image\n", elfPath);
+		fclose (file);
+		free (image);
+		return 0;
+	}
+	fclose (file);
+
+	for (i = 0; i < BENCH_NUM_OF_FUNCTIONS; i++)
+	{
+		g_functions[i].entry = Bench_findSymbol (image, (size_t)size, g_functions[i].name);
+		if (g_functions[i].entry == 0)
+		{
+			fprintf (stderr, "%s: function %s not found\n", elfPath, g_functions[i].name);
+			ok = 0;
+		}
+	}
+	g_loop.entry = Bench_findSymbol (image, (size_t)size, BENCH_LOOP_ANCHOR);
+	if (g_loop.entry == 0)
+	{
+		fprintf (stderr, "%s: loop anchor %s not found\n", elfPath, BENCH_LOOP_ANCHOR);
+		ok = 0;
+	}
+	free (image);
+	return ok;
+}
+
+static void Bench_addSample (Bench_FunctionType * func, uint64_t cycles)
+{
+	if ((func->calls == 0) || (cycles < func->minCycles))
+	{
+		func->minCycles = cycles;
+	}
+	if (cycles > func->maxCycles)
+	{
+		func->maxCycles = cycles;
+	}
+	func->totalCycles += cycles;
+	func->calls++;
+}
+
+static uint64_t Bench_mean (const Bench_FunctionType * func)
+{
+	return (func->calls == 0) ? 0 : (func->totalCycles + func->calls / 2) / func->calls;
+}
+
+/*
+ * Description :
+ * Run the firmware one instruction at a time and time every profiled call.
+ * The loop iteration is measured between two consecutive entries of the anchor,
+ * the first warmup iterations are skipped as they still bring the LCD up.
+ * The boot is the cycle count from the reset to the first entry of the PWM driver.
+ */
+static int Bench_run (avr_t * avr, uint32_t loops, uint32_t warmup)
+{
+	uint32_t anchorHits = 0;
+
+	while (anchorHits <= warmup + loops)
+	{
+		uint16_t sp;
+		size_t i;
+		int state;
+
+		if (avr->cycle > BENCH_MAX_CYCLES)
+		{
+			fprintf (stderr, "error: cycle limit reached after %u loop iterations\n", anchorHits);
+			return 0;
+		}
+
+		/* Function entries are detected before the first instruction of the function runs */
+		sp = (uint16_t)(avr->data[R_SPL] | (avr->data[R_SPH] << 8));
+		for (i = 0; i < BENCH_NUM_OF_FUNCTIONS; i++)
+		{
+			if ((avr->pc == g_functions[i].entry) && (!g_functions[i].active))
+			{
+				if ((g_boot.calls == 0) && (strcmp (g_functions[i].name, BENCH_PWM_NAME) == 0))
+				{
+					Bench_addSample (&g_boot, avr->cycle);
+				}
+				g_functions[i].active = 1;
+				g_functions[i].entrySp = sp;
+				g_functions[i].startCycle = avr->cycle;
+			}
+		}
+		if (avr->pc == g_loop.entry)
+		{
+			if (anchorHits > warmup)
+			{
+				Bench_addSample (&g_loop, avr->cycle - g_loop.startCycle);
+			}
+			g_loop.startCycle = avr->cycle;
+			anchorHits++;
+		}
+
+		state = avr_run (avr);
+		if ((state == cpu_Done) || (state == cpu_Crashed))
+		{
+			fprintf (stderr, "error: the firmware stopped (state %d)\n", state);
+			return 0;
+		}
+
+		/* RET pops the return address so the stack pointer rises above its value at entry */
+		sp = (uint16_t)(avr->data[R_SPL] | (avr->data[R_SPH] << 8));
+		for (i = 0; i < BENCH_NUM_OF_FUNCTIONS; i++)
+		{
+			if (g_functions[i].active && (sp > g_functions[i].entrySp))
+			{
+				g_functions[i].active = 0;
+				Bench_addSample (&g_functions[i], avr->cycle - g_functions[i].startCycle);
+			}
+		}
+	}
+	return 1;
+}
+
+/*
+ * Description :
+ * Find the baseline of a benchmark by name in the baseline file.
+ * Returns 0 if the benchmark has no baseline.
+ */
+static uint64_t Bench_readBaseline (const char * path, const char * name)
+{
+	FILE * file = fopen (path, "r");
+	char line[128];
+	char entry[64];
+	unsigned long long cycles;
+	uint64_t result = 0;
+
+	if (file == NULL)
+	{
+		return 0;
+	}
+	while (fgets (line, sizeof(line), file) != NULL)
+	{
+		if ((line[0] != '#') && (sscanf (line, "%63s %llu", entry, &cycles) == 2) && (strcmp (entry, name) == 0))
+		{
+			result = cycles;
+			break;
+		}
+	}
+	fclose (file);
+	return result;
+}
+
+/*
+ * Description :
+ * Print one benchmark line and compare it with its baseline.
+ * Returns 0 if the benchmark regressed beyond the tolerance.
+ */
+static int Bench_report (const Bench_FunctionType * func, const char * baselinePath, double tolerance)
+{
+	uint64_t mean = Bench_mean (func);
+	uint64_t baseline = (baselinePath != NULL) ? Bench_readBaseline (baselinePath, func->name) : 0;
+	const char * verdict = "";
+	int ok = 1;
+
+	if (func->calls == 0)
+	{
+		verdict = "NOT CALLED";
+		ok = 0;
+	}
+	else if (baseline != 0)
+	{
+		if ((double)mean > (double)baseline * (1.0 + tolerance / 100.0))
+		{
+			verdict = "REGRESSION";
+			ok = 0;
+		}
+		else
+		{
+			verdict = "ok";
+		}
+	}
+	else if (baselinePath != NULL)
+	{
+		verdict = "no baseline";
+	}
+
+	printf ("%-18s %8u %10llu %10llu %10llu %10llu  %s\n", func->name, func->calls,
+			(unsigned long long)func->minCycles, (unsigned long long)mean,
+			(unsigned long long)func->maxCycles, (unsigned long long)baseline, verdict);
+	return ok;
+}
+
+static int Bench_writeBaseline (const char * path)
+{
+	FILE * file = fopen (path, "w");
+	size_t i;
+
+	if (file == NULL)
+	{
+		perror (path);
+		return 0;
+	}
+	fprintf (file, "# Mean cycles per call measured by bench_runner under simavr at %lu Hz\n", BENCH_MCU_FREQUENCY);
+	for (i = 0; i < BENCH_NUM_OF_FUNCTIONS; i++)
+	{
+		fprintf (file, "%s %llu\n", g_functions[i].name, (unsigned long long)Bench_mean (&g_functions[i]));
+	}
+	fprintf (file, "%s %llu\n", g_loop.name, (unsigned long long)Bench_mean (&g_loop));
+	fprintf (file, "%s %llu\n", g_boot.name, (unsigned long long)Bench_mean (&g_boot));
+	fclose (file);
+	return 1;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (int argc, char * argv[])
+{
+	const char * baselinePath = NULL;
+	double tolerance = 2.0;
+	uint32_t loops = 8;
+	uint32_t warmup = 64;
+	uint32_t lm35Millivolts = 500;
+	int update = 0;
+	int ok = 1;
+	int opt;
+	size_t i;
+	elf_firmware_t firmware;
+	avr_t * avr;
+
+	while ((opt = getopt (argc, argv, "b:ut:n:w:m:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'b': baselinePath = optarg; break;
+		case 'u': update = 1; break;
+		case 't': tolerance = atof (optarg); break;
+		case 'n': loops = (uint32_t)strtoul (optarg, NULL, 0); break;
+		case 'w': warmup = (uint32_t)strtoul (optarg, NULL, 0); break;
+		case 'm': lm35Millivolts = (uint32_t)strtoul (optarg, NULL, 0); break;
+		default:
+			fprintf (stderr, "usage: %s [-b baseline] [-u] [-t pct] [-n loops] [-w loops] [-m mV] firmware.elf\n", argv[0]);
+			return 2;
+		}
+	}
+	if ((optind >= argc) || (update && (baselinePath == NULL)))
+	{
+		fprintf (stderr, "usage: %s [-b baseline] [-u] [-t pct] [-n loops] [-w loops] [-m mV] firmware.elf\n", argv[0]);
+		return 2;
+	}
+
+	if (!Bench_resolveSymbols (argv[optind]))
+	{
+		return 2;
+	}
+
+	memset (&firmware, 0, sizeof(firmware));
+	if (elf_read_firmware (argv[optind], &firmware) != 0)
+	{
+		fprintf (stderr, "%s: simavr cannot load the firmware\n", argv[optind]);
+		return 2;
+	}
+	avr = avr_make_mcu_by_name (BENCH_MCU_NAME);
+	if (avr == NULL)
+	{
+		fprintf (stderr, "simavr does not support %s\n", BENCH_MCU_NAME);
+		return 2;
+	}
+	avr_init (avr);
+	avr_load_firmware (avr, &firmware);
+	avr->frequency = BENCH_MCU_FREQUENCY;
+	avr->log = LOG_NONE;
+
+	/* LM35: 10 mV per degree on ADC channel 2 */
+	avr_raise_irq (avr_io_getirq (avr, AVR_IOCTL_ADC_GETIRQ, BENCH_LM35_ADC_IRQ), lm35Millivolts);
+
+	if (!Bench_run (avr, loops, warmup))
+	{
+		return 2;
+	}
+
+	printf ("%-18s %8s %10s %10s %10s %10s\n", "benchmark", "calls", "min", "mean", "max", "baseline");
+	for (i = 0; i < BENCH_NUM_OF_FUNCTIONS; i++)
+	{
+		ok &= Bench_report (&g_functions[i], update ? NULL : baselinePath, tolerance);
+	}
+	ok &= Bench_report (&g_loop, update ? NULL : baselinePath, tolerance);
+	ok &= Bench_report (&g_boot, update ? NULL : baselinePath, tolerance);
+
+	if (update)
+	{
+		return Bench_writeBaseline (baselinePath) ? 0 : 2;
+	}
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+/******************************************************************************
+ *
+ * Module: ADC_TRACE
+ *
+ * File Name: adc_trace.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the traces of timestamped raw ADC codes recorded
+ *              by the simulator (or converted from a board log) and replayed
+ *              through the firmware control path.
+ *
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "adc_trace.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define ADC_TRACE_INITIAL_CAPACITY               4096
+#define ADC_TRACE_MAX_CODE                       0x3FF
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Write the format line at the start of a trace file.
+ */
+void AdcTrace_writeHeader (FILE * stream)
+{
+	fprintf (stream, "# adc trace: time_ms channel code\n");
+}
+
+/*
+ * Description :
+ * Append one conversion to a trace file.
+ */
+void AdcTrace_writeSample (FILE * stream, uint32 timeMs, uint8 channel, uint16 code)
+{
+	fprintf (stream, "%lu %u %u\n", (unsigned long)timeMs, channel, code);
+}
+
+/*
+ * Description :
+ * Read a whole trace file into memory, the samples are freed with AdcTrace_free.
+ * Returns FALSE with a message if the file cannot be read or is not a valid trace.
+ */
+bool AdcTrace_load (AdcTrace_Type * trace, const char * path)
+{
+	FILE * file = fopen (path, "r");
+	char line[128];
+	unsigned long timeMs;
+	unsigned int channel;
+	unsigned int code;
+	uint32 lineNumber = 0;
+
+	memset (trace, 0, sizeof(*trace));
+	if (file == NULL)
+	{
+		perror (path);
+		return FALSE;
+	}
+
+	while (fgets (line, sizeof(line), file) != NULL)
+	{
+		lineNumber++;
+		if ((line[0] == '#') || (line[0] == '\n'))
+		{
+			continue;
+		}
+		if ((sscanf (line, "%lu %u %u", &timeMs, &channel, &code) != 3) || (channel > 0xFF) ||
+				(code > ADC_TRACE_MAX_CODE) || ((trace->count > 0) && (timeMs < trace->samples[trace->count - 1].timeMs)))
+		{
+			fprintf (stderr, "%s:%lu: not a \"time_ms channel code\" line or time going back\n", path, (unsigned long)lineNumber);
+			fclose (file);
+			AdcTrace_free (trace);
+			return FALSE;
+		}
+
+		/* Grow by doubling, a day of 50 ms iterations is about 1.7 million samples */
+		if (trace->count == trace->capacity)
+		{
+			uint32 capacity = (trace->capacity == 0) ? ADC_TRACE_INITIAL_CAPACITY : 2 * trace->capacity;
+			AdcTrace_SampleType * samples = realloc (trace->samples, capacity * sizeof(AdcTrace_SampleType));
+			if (samples == NULL)
+			{
+				fprintf (stderr, "%s: out of memory\n", path);
+				fclose (file);
+				AdcTrace_free (trace);
+				return FALSE;
+			}
+			trace->samples = samples;
+			trace->capacity = capacity;
+		}
+		trace->samples[trace->count].timeMs = (uint32)timeMs;
+		trace->samples[trace->count].channel = (uint8)channel;
+		trace->samples[trace->count].code = (uint16)code;
+		trace->count++;
+	}
+	fclose (file);
+
+	if (trace->count == 0)
+	{
+		fprintf (stderr, "%s: no samples\n", path);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Free the samples of a loaded trace.
+ */
+void AdcTrace_free (AdcTrace_Type * trace)
+{
+	free (trace->samples);
+	memset (trace, 0, sizeof(*trace));
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Module: ADC_TRACE
+ *
+ * File Name: adc_trace.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the traces of timestamped raw ADC codes recorded
+ *              by the simulator (or converted from a board log) and replayed
+ *              through the firmware control path.
+ *
+ *              Text format, one conversion per line, '#' starts a comment:
+ *                time_ms channel code
+ *              The times never decrease, the conversions of one superloop
+ *              iteration share its time.
+ *
+ *******************************************************************************/
+
+#ifndef ADC_TRACE_H_
+#define ADC_TRACE_H_
+
+#include <stdio.h>
+#include "std_types.h"
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	uint32 timeMs;
+	uint8 channel;
+	uint16 code;                       /* 10-bit ADC code */
+} AdcTrace_SampleType;
+
+typedef struct{
+	AdcTrace_SampleType * samples;
+	uint32 count;
+	uint32 capacity;
+} AdcTrace_Type;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Write the format line at the start of a trace file.
+ */
+void AdcTrace_writeHeader (FILE * stream);
+
+/*
+ * Description :
+ * Append one conversion to a trace file.
+ */
+void AdcTrace_writeSample (FILE * stream, uint32 timeMs, uint8 channel, uint16 code);
+
+/*
+ * Description :
+ * Read a whole trace file into memory, the samples are freed with AdcTrace_free.
+ * Returns FALSE with a message if the file cannot be read or is not a valid trace.
+ */
+bool AdcTrace_load (AdcTrace_Type * trace, const char * path);
+
+/*
+ * Description :
+ * Free the samples of a loaded trace.
+ */
+void AdcTrace_free (AdcTrace_Type * trace);
+
+#endif /* ADC_TRACE_H_ */
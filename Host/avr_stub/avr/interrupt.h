@@ -0,0 +1,28 @@
+/******************************************************************************
+ *
+ * Module: AVR_STUB
+ *
+ * File Name: avr/interrupt.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Host stand-in of <avr/interrupt.h>. An ISR is a plain function
+ *              called by the simulated peripheral that raises it, so enabling
+ *              and disabling the interrupts has nothing to do.
+ *
+ *******************************************************************************/
+
+#ifndef HOST_AVR_INTERRUPT_H_
+#define HOST_AVR_INTERRUPT_H_
+
+#define cli()
+#define sei()
+
+#define ISR(VECTOR)                              void VECTOR (void)
+#define TWI_vect                                 HostIo_twiInterrupt
+
+void HostIo_twiInterrupt (void);
+
+#endif /* HOST_AVR_INTERRUPT_H_ */
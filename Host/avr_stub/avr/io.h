@@ -0,0 +1,57 @@
+/******************************************************************************
+ *
+ * Module: AVR_STUB
+ *
+ * File Name: avr/io.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Host stand-in of <avr/io.h> for the firmware drivers built by
+ *              Host/makefile. The registers they use are plain bytes of
+ *              g_hostIoRegisters, the simulated peripherals of bus_sim.c act on
+ *              them between the driver calls.
+ *
+ *******************************************************************************/
+
+#ifndef HOST_AVR_IO_H_
+#define HOST_AVR_IO_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	HOST_IO_PORTD, HOST_IO_DDRD, HOST_IO_PIND, HOST_IO_TWBR, HOST_IO_TWSR, HOST_IO_TWDR, HOST_IO_TWCR,
+	HOST_IO_NUM_OF_REGISTERS
+} HostIo_RegisterType;
+
+/*******************************************************************************
+ *                           External Variables                                *
+ *******************************************************************************/
+extern volatile uint8 g_hostIoRegisters[HOST_IO_NUM_OF_REGISTERS];
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define PORTD                                    (g_hostIoRegisters[HOST_IO_PORTD])
+#define DDRD                                     (g_hostIoRegisters[HOST_IO_DDRD])
+#define PIND                                     (g_hostIoRegisters[HOST_IO_PIND])
+#define TWBR                                     (g_hostIoRegisters[HOST_IO_TWBR])
+#define TWSR                                     (g_hostIoRegisters[HOST_IO_TWSR])
+#define TWDR                                     (g_hostIoRegisters[HOST_IO_TWDR])
+#define TWCR                                     (g_hostIoRegisters[HOST_IO_TWCR])
+
+/* TWCR bits */
+#define TWIE                                     0
+#define TWEN                                     2
+#define TWWC                                     3
+#define TWSTO                                    4
+#define TWSTA                                    5
+#define TWEA                                     6
+#define TWINT                                    7
+
+#endif /* HOST_AVR_IO_H_ */
@@ -0,0 +1,22 @@
+/******************************************************************************
+ *
+ * Module: AVR_STUB
+ *
+ * File Name: util/delay.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Host stand-in of <util/delay.h>. The busy waits advance the
+ *              simulated time of bus_sim.c instead of spinning.
+ *
+ *******************************************************************************/
+
+#ifndef HOST_UTIL_DELAY_H_
+#define HOST_UTIL_DELAY_H_
+
+void _delay_us (double us);
+void _delay_ms (double ms);
+
+#endif /* HOST_UTIL_DELAY_H_ */
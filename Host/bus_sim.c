@@ -0,0 +1,403 @@
+/******************************************************************************
+ *
+ * Module: BUS_SIM
+ *
+ * File Name: bus_sim.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Simulated sensor buses of the host build. The DS18B20 decodes the
+ *              1-Wire slots from the width of the low pulses of the master and
+ *              answers by pulling the bus low, the TWI hardware executes the
+ *              actions written to TWCR against an LM75 slave and raises the TWI
+ *              interrupt as the ATmega32 module does.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/delay.h>
+#include <util/twi.h>
+#include "bus_sim.h"
+#include "one_wire.h"
+#include "lm75.h"
+#include "ds18b20.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* DS18B20 datasheet timings in us */
+#define BUS_SIM_RESET_MIN_US                     480        /* A longer low pulse is a reset */
+#define BUS_SIM_WRITE_ZERO_MIN_US                15         /* A longer low pulse writes a 0 */
+#define BUS_SIM_PRESENCE_WAIT_US                 30
+#define BUS_SIM_PRESENCE_US                      120
+#define BUS_SIM_READ_ZERO_US                     15         /* The device holds a 0 at least this long after the falling edge */
+
+#define BUS_SIM_MAX_TWI_ACTIONS                  64         /* Guards against a driver that never waits */
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	BUS_SIM_OW_IDLE, BUS_SIM_OW_ROM_COMMAND, BUS_SIM_OW_FUNCTION_COMMAND, BUS_SIM_OW_TRANSMIT
+} BusSim_OneWireStateType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+volatile uint8 g_hostIoRegisters[HOST_IO_NUM_OF_REGISTERS];
+
+static uint32 g_micros = 0;
+static BusSim_StatsType g_stats;
+
+/* 1-Wire bus and DS18B20 */
+static BusSim_Ds18b20Type g_ds18b20;
+static bool g_masterLow = FALSE;
+static uint32 g_fallMicros = 0;
+static uint32 g_presenceStart = 0;
+static uint32 g_presenceEnd = 0;
+static uint32 g_bitLowEnd = 0;
+static BusSim_OneWireStateType g_oneWireState = BUS_SIM_OW_IDLE;
+static uint8 g_rxByte = 0;
+static uint8 g_rxBits = 0;
+static uint8 g_scratchpad[DS18B20_SCRATCHPAD_SIZE];
+static uint8 g_txBit = 0;
+static sint16 g_convertedRaw = BUS_SIM_DS18B20_POWER_ON_RAW;
+
+/* TWI module and LM75 */
+static BusSim_Lm75Type g_lm75;
+static bool g_twiStarted = FALSE;
+static uint8 g_lm75ReadIndex = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* Written independently of OneWire_crc8 so the test checks the driver against it */
+static uint8 BusSim_crc8 (const uint8 * data, uint8 length)
+{
+	uint8 crc = 0;
+	uint8 i;
+	uint8 bit;
+
+	for (i = 0; i < length; i++)
+	{
+		for (bit = 0; bit < 8; bit++)
+		{
+			uint8 mix = (crc ^ (data[i] >> bit)) & 0x01;
+			crc >>= 1;
+			if (mix)
+			{
+				crc ^= 0x8C;               /* x^8 + x^5 + x^4 + 1, reflected */
+			}
+		}
+	}
+	return crc;
+}
+
+static void BusSim_loadScratchpad (void)
+{
+	g_scratchpad[0] = (uint8)g_convertedRaw;
+	g_scratchpad[1] = (uint8)((uint16)g_convertedRaw >> 8);
+	g_scratchpad[2] = 0x4B;                    /* TH, TL and configuration at their power-on values */
+	g_scratchpad[3] = 0x46;
+	g_scratchpad[4] = 0x7F;
+	g_scratchpad[5] = 0xFF;
+	g_scratchpad[6] = 0x0C;
+	g_scratchpad[7] = 0x10;
+	g_scratchpad[8] = BusSim_crc8 (g_scratchpad, DS18B20_SCRATCHPAD_SIZE - 1);
+	if (g_ds18b20.corruptCrc)
+	{
+		g_scratchpad[8] ^= 0x01;
+	}
+	g_txBit = 0;
+}
+
+static void BusSim_receiveByte (uint8 byte)
+{
+	switch (g_oneWireState)
+	{
+	case BUS_SIM_OW_ROM_COMMAND:
+		g_oneWireState = (byte == ONE_WIRE_SKIP_ROM) ? BUS_SIM_OW_FUNCTION_COMMAND : BUS_SIM_OW_IDLE;
+		break;
+
+	case BUS_SIM_OW_FUNCTION_COMMAND:
+		if (byte == DS18B20_CONVERT_T)
+		{
+			g_convertedRaw = g_ds18b20.raw;
+			g_stats.conversions++;
+			g_oneWireState = BUS_SIM_OW_IDLE;
+		}
+		else if (byte == DS18B20_READ_SCRATCHPAD)
+		{
+			BusSim_loadScratchpad ();
+			g_oneWireState = BUS_SIM_OW_TRANSMIT;
+		}
+		else
+		{
+			g_oneWireState = BUS_SIM_OW_IDLE;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/*
+ * Complete a TWI action written to TWCR and return the new status, or TW_NO_INFO
+ * if the action gives no interrupt (STOP) or is not valid in the current state.
+ */
+static uint8 BusSim_twiAction (uint8 control)
+{
+	uint8 status = TW_STATUS;
+	uint8 address;
+
+	if (control & (1 << TWSTO))
+	{
+		g_twiStarted = FALSE;
+		g_stats.twiStops++;
+		TWCR &= (uint8)~(1 << TWSTO);          /* Cleared by the hardware once the STOP is sent */
+		return TW_NO_INFO;
+	}
+	if (control & (1 << TWSTA))
+	{
+		status = g_twiStarted ? TW_REP_START : TW_START;
+		g_twiStarted = TRUE;
+		g_stats.twiStarts++;
+		return status;
+	}
+
+	switch (status)
+	{
+	case TW_START:
+	case TW_REP_START:
+		address = TWDR >> 1;
+		if (g_lm75.present && (address == LM75_ADDRESS))
+		{
+			g_lm75ReadIndex = 0;
+			return (TWDR & TW_READ) ? TW_MR_SLA_ACK : TW_MT_SLA_ACK;
+		}
+		return (TWDR & TW_READ) ? TW_MR_SLA_NACK : TW_MT_SLA_NACK;
+
+	case TW_MT_SLA_ACK:
+	case TW_MT_DATA_ACK:
+		g_stats.lm75Pointer = TWDR;
+		return TW_MT_DATA_ACK;
+
+	case TW_MR_SLA_ACK:
+	case TW_MR_DATA_ACK:
+		/* The LM75 repeats its two bytes for a longer read */
+		TWDR = g_lm75.temperature[g_lm75ReadIndex & 0x01];
+		g_lm75ReadIndex++;
+		g_stats.lm75ReadBytes = g_lm75ReadIndex;
+		return (control & (1 << TWEA)) ? TW_MR_DATA_ACK : TW_MR_DATA_NACK;
+
+	default:
+		return TW_NO_INFO;
+	}
+}
+
+/*******************************************************************************
+ *                      Host Stand-ins Definitions                             *
+ *******************************************************************************/
+void _delay_us (double us)
+{
+	g_micros += (uint32)(us + 0.5);
+}
+
+void _delay_ms (double ms)
+{
+	g_micros += (uint32)(ms * 1000.0 + 0.5);
+}
+
+/*
+ * Description :
+ * Pin access of the host build, provided by the simulated bus (Host/bus_sim.c):
+ * drive the bus low or release it, and read the level of the bus.
+ */
+void OneWire_hostDrive (bool low)
+{
+	uint32 width;
+
+	if (low)
+	{
+		if (!g_masterLow)
+		{
+			g_masterLow = TRUE;
+			g_fallMicros = g_micros;
+			/* A read slot: the device answers a 0 by holding the bus from the falling edge */
+			if (g_ds18b20.present && (g_oneWireState == BUS_SIM_OW_TRANSMIT))
+			{
+				uint8 bit = 1;                 /* Released bus after the last scratchpad byte */
+
+				if (g_txBit < DS18B20_SCRATCHPAD_SIZE * 8)
+				{
+					bit = (g_scratchpad[g_txBit / 8] >> (g_txBit % 8)) & 0x01;
+					if ((g_txBit % 8) == 7)
+					{
+						g_stats.scratchpadBytes++;
+					}
+					g_txBit++;
+				}
+				g_bitLowEnd = bit ? g_micros : g_micros + BUS_SIM_READ_ZERO_US;
+			}
+		}
+		return;
+	}
+	if (!g_masterLow)
+	{
+		return;
+	}
+	g_masterLow = FALSE;
+	width = g_micros - g_fallMicros;
+
+	if (width >= BUS_SIM_RESET_MIN_US)
+	{
+		g_stats.resets++;
+		g_rxBits = 0;
+		g_bitLowEnd = 0;
+		g_presenceStart = g_micros + BUS_SIM_PRESENCE_WAIT_US;
+		g_presenceEnd = g_ds18b20.present ? g_presenceStart + BUS_SIM_PRESENCE_US : g_presenceStart;
+		g_oneWireState = g_ds18b20.present ? BUS_SIM_OW_ROM_COMMAND : BUS_SIM_OW_IDLE;
+		return;
+	}
+	if ((g_oneWireState == BUS_SIM_OW_ROM_COMMAND) || (g_oneWireState == BUS_SIM_OW_FUNCTION_COMMAND))
+	{
+		/* Write slot, LSB first */
+		if (width < BUS_SIM_WRITE_ZERO_MIN_US)
+		{
+			g_rxByte |= (uint8)(1 << g_rxBits);
+		}
+		else
+		{
+			g_rxByte &= (uint8)~(1 << g_rxBits);
+		}
+		if (++g_rxBits == 8)
+		{
+			g_rxBits = 0;
+			BusSim_receiveByte (g_rxByte);
+		}
+	}
+}
+
+uint8 OneWire_hostRead (void)
+{
+	if (g_masterLow)
+	{
+		return LOGIC_LOW;
+	}
+	if ((g_micros >= g_presenceStart) && (g_micros < g_presenceEnd))
+	{
+		return LOGIC_LOW;
+	}
+	return (g_micros < g_bitLowEnd) ? LOGIC_LOW : LOGIC_HIGH;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clear the registers, the simulated time and the statistics, and configure the
+ * simulated devices.
+ */
+void BusSim_reset (const BusSim_Ds18b20Type * Ds18b20_Ptr, const BusSim_Lm75Type * Lm75_Ptr)
+{
+	memset ((void *)g_hostIoRegisters, 0, sizeof(g_hostIoRegisters));
+	memset (&g_stats, 0, sizeof(g_stats));
+	g_micros = 0;
+	g_masterLow = FALSE;
+	g_presenceStart = 0;
+	g_presenceEnd = 0;
+	g_bitLowEnd = 0;
+	g_oneWireState = BUS_SIM_OW_IDLE;
+	g_rxBits = 0;
+	g_convertedRaw = BUS_SIM_DS18B20_POWER_ON_RAW;
+	g_twiStarted = FALSE;
+	BusSim_setDs18b20 (Ds18b20_Ptr);
+	BusSim_setLm75 (Lm75_Ptr);
+}
+
+/*
+ * Description :
+ * Change the configuration of the devices without resetting the buses.
+ */
+void BusSim_setDs18b20 (const BusSim_Ds18b20Type * Ds18b20_Ptr)
+{
+	g_ds18b20 = *Ds18b20_Ptr;
+}
+
+void BusSim_setLm75 (const BusSim_Lm75Type * Lm75_Ptr)
+{
+	g_lm75 = *Lm75_Ptr;
+}
+
+/*
+ * Description :
+ * Run the TWI hardware on the actions written to TWCR and call the TWI interrupt
+ * for every completed one, until the module waits for the software or the bus.
+ */
+void BusSim_runTwi (void)
+{
+	uint8 actions;
+
+	for (actions = 0; actions < BUS_SIM_MAX_TWI_ACTIONS; actions++)
+	{
+		uint8 control = TWCR;
+		uint8 status;
+
+		/* Writing TWINT to one starts the action, a disabled module drops the bus */
+		if ((control & (1 << TWEN)) == 0)
+		{
+			g_twiStarted = FALSE;
+			return;
+		}
+		if ((control & (1 << TWINT)) == 0)
+		{
+			return;
+		}
+		if (g_lm75.holdBus)
+		{
+			return;                            /* SDA held low: the action never completes */
+		}
+
+		TWCR = control & (uint8)~(1 << TWINT);
+		status = BusSim_twiAction (control);
+		if (status == TW_NO_INFO)
+		{
+			continue;
+		}
+		TWSR = (TWSR & (uint8)~TW_STATUS_MASK) | status;
+		/* Only the interrupt driven master of twi.c is modeled, its handler writes the next action */
+		if ((control & (1 << TWIE)) == 0)
+		{
+			return;
+		}
+		HostIo_twiInterrupt ();
+	}
+}
+
+/*
+ * Description :
+ * Return the simulated time in microseconds, advanced by the busy waits.
+ */
+uint32 BusSim_getMicros (void)
+{
+	return g_micros;
+}
+
+/*
+ * Description :
+ * Copy the bus statistics.
+ */
+void BusSim_getStats (BusSim_StatsType * Stats_Ptr)
+{
+	*Stats_Ptr = g_stats;
+}
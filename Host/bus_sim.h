@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Module: BUS_SIM
+ *
+ * File Name: bus_sim.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the simulated sensor buses of the host build:
+ *              a DS18B20 on the 1-Wire pin, timed by the busy waits of the
+ *              driver, and the ATmega32 TWI master with an LM75 slave, driven by
+ *              the TWCR / TWSR / TWDR registers of avr_stub/avr/io.h.
+ *
+ *******************************************************************************/
+
+#ifndef BUS_SIM_H_
+#define BUS_SIM_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define BUS_SIM_DS18B20_POWER_ON_RAW             0x0550     /* 85 C, the scratchpad before the first conversion */
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	bool present;                      /* Answers the reset pulse */
+	sint16 raw;                        /* Temperature of the next conversion in 1/16 C */
+	bool corruptCrc;                   /* Sends a wrong scratchpad CRC */
+} BusSim_Ds18b20Type;
+
+typedef struct{
+	bool present;                      /* Acknowledges its address */
+	uint8 temperature[2];              /* Temperature register, MSB first */
+	bool holdBus;                      /* Holds SDA low, no START completes until released */
+} BusSim_Lm75Type;
+
+typedef struct{
+	uint32 resets;                     /* 1-Wire reset pulses */
+	uint32 conversions;                /* DS18B20 Convert T commands */
+	uint32 scratchpadBytes;            /* DS18B20 scratchpad bytes sent */
+	uint32 twiStarts;                  /* START and repeated START conditions */
+	uint32 twiStops;
+	uint8 lm75Pointer;                 /* Last pointer register written to the LM75 */
+	uint8 lm75ReadBytes;               /* Bytes sent by the LM75 in its last read, the master NACKs the last one */
+} BusSim_StatsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clear the registers, the simulated time and the statistics, and configure the
+ * simulated devices.
+ */
+void BusSim_reset (const BusSim_Ds18b20Type * Ds18b20_Ptr, const BusSim_Lm75Type * Lm75_Ptr);
+
+/*
+ * Description :
+ * Change the configuration of the devices without resetting the buses.
+ */
+void BusSim_setDs18b20 (const BusSim_Ds18b20Type * Ds18b20_Ptr);
+void BusSim_setLm75 (const BusSim_Lm75Type * Lm75_Ptr);
+
+/*
+ * Description :
+ * Run the TWI hardware on the actions written to TWCR and call the TWI interrupt
+ * for every completed one, until the module waits for the software or the bus.
+ */
+void BusSim_runTwi (void);
+
+/*
+ * Description :
+ * Return the simulated time in microseconds, advanced by the busy waits.
+ */
+uint32 BusSim_getMicros (void);
+
+/*
+ * Description :
+ * Copy the bus statistics.
+ */
+void BusSim_getStats (BusSim_StatsType * Stats_Ptr);
+
+#endif /* BUS_SIM_H_ */
@@ -0,0 +1,212 @@
+/******************************************************************************
+ *
+ * Module: BUS_TEST
+ *
+ * File Name: bus_test.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Host test of the unmodified ONE_WIRE, DS18B20, TWI and LM75
+ *              drivers against the simulated devices of bus_sim.c: scratchpad
+ *              read and CRC check, Q8.8 decoding of both sensors, and the missing
+ *              device, CRC error, NACK, stuck bus timeout and TWI_init recovery
+ *              paths. Exits with status 1 if any check fails.
+ *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <avr/io.h>
+#include "bus_sim.h"
+#include "host_board.h"
+#include "one_wire.h"
+#include "ds18b20.h"
+#include "twi.h"
+#include "lm75.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define BUS_TEST_MAX_STEP_US                     1000       /* Longest DS18B20 step of the README */
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static HostBoard_Type g_board;
+static uint32 g_failures = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void BusTest_check (bool ok, const char * name)
+{
+	printf ("%-60s %s\n", name, ok ? "ok" : "FAILED");
+	if (!ok)
+	{
+		g_failures++;
+	}
+}
+
+/* One DS18B20 measurement period, a step per system tick; returns the longest step in us */
+static uint32 BusTest_runDs18b20Period (void)
+{
+	uint32 longest = 0;
+	uint32 i;
+
+	for (i = 0; i < SYS_TICK_MS_TO_TICKS (DS18B20_PERIOD_MS); i++)
+	{
+		uint32 start = BusSim_getMicros ();
+		DS18B20_step ();
+		if (BusSim_getMicros () - start > longest)
+		{
+			longest = BusSim_getMicros () - start;
+		}
+		g_board.ticks++;
+	}
+	return longest;
+}
+
+/* One LM75 period, the TWI interrupts run between the steps as they do on the target */
+static void BusTest_runLm75Period (void)
+{
+	uint32 i;
+
+	for (i = 0; i < SYS_TICK_MS_TO_TICKS (LM75_PERIOD_MS); i++)
+	{
+		LM75_step ();
+		BusSim_runTwi ();
+		g_board.ticks++;
+	}
+}
+
+static void BusTest_crc (void)
+{
+	/* ROM code example of the Maxim 1-Wire CRC application note */
+	static const uint8 rom[] = {0x02, 0x1C, 0xB8, 0x01, 0x00, 0x00, 0x00};
+	uint8 crc = 0;
+	uint8 i;
+
+	for (i = 0; i < sizeof(rom); i++)
+	{
+		crc = OneWire_crc8 (crc, rom[i]);
+	}
+	BusTest_check (crc == 0xA2, "crc8 of the application note ROM code is 0xA2");
+	BusTest_check (OneWire_crc8 (crc, crc) == 0, "crc8 over the data and its CRC is zero");
+}
+
+static void BusTest_ds18b20 (void)
+{
+	BusSim_Ds18b20Type device = {TRUE, 0x0191, FALSE};       /* 25.0625 C */
+	BusSim_Lm75Type lm75 = {FALSE, {0, 0}, FALSE};
+	BusSim_StatsType stats;
+	sint16 temperature;
+	uint32 longest;
+
+	HostBoard_bind (&g_board, NULL_PTR, NULL_PTR);
+	BusSim_reset (&device, &lm75);
+	DS18B20_init ();
+	BusTest_check (DS18B20_getTemperature (&temperature) == DS18B20_STATUS_NO_DATA, "ds18b20 has no data before the first measurement");
+
+	longest = BusTest_runDs18b20Period ();
+	BusSim_getStats (&stats);
+	BusTest_check ((DS18B20_getTemperature (&temperature) == DS18B20_STATUS_OK) && (temperature == 0x1910),
+			"ds18b20 25.0625 C reads 0x1910 in Q8.8");
+	BusTest_check ((stats.resets == 2) && (stats.conversions == 1) && (stats.scratchpadBytes == DS18B20_SCRATCHPAD_SIZE),
+			"ds18b20 convert then read the whole scratchpad");
+	BusTest_check (longest <= BUS_TEST_MAX_STEP_US, "ds18b20 step stays within 1 ms of bus time");
+
+	device.raw = -162;                                        /* -10.125 C */
+	BusSim_setDs18b20 (&device);
+	BusTest_runDs18b20Period ();
+	BusTest_check ((DS18B20_getTemperature (&temperature) == DS18B20_STATUS_OK) && (temperature == -2592),
+			"ds18b20 -10.125 C reads -2592 in Q8.8");
+
+	device.corruptCrc = TRUE;
+	device.raw = 0x0320;                                      /* 50 C, must not be taken */
+	BusSim_setDs18b20 (&device);
+	BusTest_runDs18b20Period ();
+	BusTest_check ((DS18B20_getTemperature (&temperature) == DS18B20_STATUS_CRC_ERROR) && (temperature == -2592),
+			"ds18b20 CRC error keeps the last valid temperature");
+
+	device.present = FALSE;
+	device.corruptCrc = FALSE;
+	BusSim_setDs18b20 (&device);
+	BusTest_runDs18b20Period ();
+	BusTest_check (DS18B20_getTemperature (&temperature) == DS18B20_STATUS_NO_DEVICE, "ds18b20 without presence pulse reports no device");
+
+	device.present = TRUE;
+	BusSim_setDs18b20 (&device);
+	BusTest_runDs18b20Period ();
+	BusTest_check ((DS18B20_getTemperature (&temperature) == DS18B20_STATUS_OK) && (temperature == 0x3200),
+			"ds18b20 recovers once the device answers again");
+}
+
+static void BusTest_lm75Value (uint8 msb, uint8 lsb, sint16 expected, const char * name)
+{
+	BusSim_Lm75Type device = {TRUE, {msb, lsb}, FALSE};
+	sint16 temperature;
+
+	BusSim_setLm75 (&device);
+	BusTest_runLm75Period ();
+	BusTest_check ((LM75_getTemperature (&temperature) == LM75_STATUS_OK) && (temperature == expected), name);
+}
+
+static void BusTest_lm75 (void)
+{
+	BusSim_Ds18b20Type ds18b20 = {FALSE, 0, FALSE};
+	BusSim_Lm75Type device = {TRUE, {0x19, 0x80}, FALSE};
+	BusSim_StatsType stats;
+	sint16 temperature;
+
+	HostBoard_bind (&g_board, NULL_PTR, NULL_PTR);
+	BusSim_reset (&ds18b20, &device);
+	LM75_init ();
+	BusTest_runLm75Period ();
+	BusSim_getStats (&stats);
+	BusTest_check ((LM75_getTemperature (&temperature) == LM75_STATUS_OK) && (temperature == 0x1980),
+			"lm75 25.5 C reads 0x1980 in Q8.8");
+	BusTest_check ((stats.lm75Pointer == LM75_TEMPERATURE_REGISTER) && (stats.twiStarts == 2) && (stats.twiStops == 1),
+			"lm75 pointer write, repeated start, read and stop");
+	BusTest_check (stats.lm75ReadBytes == 2, "twi NACKs the second byte so the slave sends no more");
+
+	BusTest_lm75Value (0xE7, 0x00, -6400, "lm75 -25 C reads -6400 in Q8.8");
+	BusTest_lm75Value (0xFF, 0x80, -128, "lm75 -0.5 C reads -128 in Q8.8");
+	BusTest_lm75Value (0x7D, 0x00, 32000, "lm75 125 C reads 32000 in Q8.8");
+	BusTest_lm75Value (0xC9, 0x00, -14080, "lm75 -55 C reads -14080 in Q8.8");
+
+	/* Address not acknowledged */
+	device.present = FALSE;
+	BusSim_setLm75 (&device);
+	BusTest_runLm75Period ();
+	BusTest_check ((LM75_getTemperature (&temperature) == LM75_STATUS_NO_DEVICE) && (temperature == -14080),
+			"lm75 address NACK reports no device and keeps the value");
+	BusTest_check ((TWI_getStatus () == TWI_ERROR) && ((TWCR & (1 << TWSTO)) == 0), "twi NACK ends with a stop and the error status");
+
+	/* A slave holding SDA low: the transfer never completes */
+	device.present = TRUE;
+	device.holdBus = TRUE;
+	BusSim_setLm75 (&device);
+	BusTest_runLm75Period ();
+	BusTest_check (LM75_getTemperature (&temperature) == LM75_STATUS_TIMEOUT, "lm75 stuck bus times out");
+	BusTest_check ((TWI_getStatus () == TWI_IDLE) && (TWCR == (1 << TWEN)) && (TWBR == TWI_BIT_RATE),
+			"twi_init resets the module after the timeout");
+
+	/* The slave lets go, the re-initialized module works again */
+	device.holdBus = FALSE;
+	BusTest_lm75Value (0x1E, 0x00, 0x1E00, "lm75 reads again after the TWI_init recovery");
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (void)
+{
+	BusTest_crc ();
+	BusTest_ds18b20 ();
+	BusTest_lm75 ();
+
+	printf ("%s\n", (g_failures == 0) ? "bus tests passed" : "bus tests FAILED");
+	return (g_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,452 @@
+/******************************************************************************
+ *
+ * Module: CLOSED_LOOP
+ *
+ * File Name: closed_loop.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the closed-loop run of a fan control strategy
+ *              against the thermal plant, through the host board drivers.
+ *
+ *******************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "closed_loop.h"
+#include "host_board.h"
+#include "adc_trace.h"
+#include "adc.h"
+#include "lm_35.h"
+#include "dc_motor.h"
+#include "fan_control.h"
+#include "sys_tick.h"
+#include "autotune.h"
+#include "sensor.h"
+#include "sensor_cfg.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define CLOSED_LOOP_FINAL_FRACTION               0.1
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/* State of the autotune strategy: the relay tuning then a PID with the tuned gains */
+typedef struct{
+	bool tuned;
+	Pid_ControllerType pid;
+	uint32 nextPidTick;                /* The tuned gains are per PID_PERIOD_MS update, as in FAN_CONTROL */
+	uint8 pidSpeed;
+} ClosedLoop_AutotuneType;
+
+typedef struct{
+	ThermalPlant_Type plant;
+	float64 noiseSigma;
+	uint32 rngState;
+	FILE * adcTrace;
+	uint32 timeMs;                     /* Time of the current superloop iteration */
+} ClosedLoop_SensorType;
+
+/*******************************************************************************
+ *                      Strategies Definitions                                 *
+ *******************************************************************************/
+
+/* The firmware policy: the same call sequence as the superloop in main.c */
+static void ClosedLoop_firmwareReset (void * state)
+{
+	(void)state;
+	FanControl_setFeedForward (FAN_FEEDFORWARD);
+	FanControl_init ();
+}
+
+/* The firmware policy with the feed-forward term switched on, as by holding register 4 */
+static void ClosedLoop_feedForwardReset (void * state)
+{
+	(void)state;
+	FanControl_setFeedForward (TRUE);
+	FanControl_init ();
+}
+
+static void ClosedLoop_firmwareStep (void * state)
+{
+	(void)state;
+	FanControl_update (LM_35_readTemp ());
+}
+
+/* The superloop path of main.c: the sensor module with its adaptive sampling, then the firmware policy */
+static void ClosedLoop_adaptiveReset (void * state)
+{
+	(void)state;
+	Sensor_init ();
+	FanControl_setFeedForward (FAN_FEEDFORWARD);
+	FanControl_init ();
+}
+
+static void ClosedLoop_adaptiveStep (void * state)
+{
+	sint16 temperature;
+
+	(void)state;
+	Sensor_update ();
+	if (Sensor_getTemperature (SENSOR_CONTROL_ID, &temperature) == SENSOR_STATUS_OK)
+	{
+		FanControl_update (Sensor_getCelsius (SENSOR_CONTROL_ID));
+	}
+	else
+	{
+		FanControl_apply (DC_MAX_SPEED);
+	}
+}
+
+static void ClosedLoop_offStep (void * state)
+{
+	(void)state;
+	LM_35_readTemp ();
+	DcMotor_stop ();
+}
+
+static void ClosedLoop_fullStep (void * state)
+{
+	(void)state;
+	LM_35_readTemp ();
+	DcMotor_rotate (CW, DC_MAX_SPEED);
+}
+
+/* The fan curve of fan_curve.h alone, without the feed-forward term of FanControl_update */
+static void ClosedLoop_ladderStep (void * state)
+{
+	static const FanControl_CurveType curve = {FAN_CURVE_THRESHOLDS, FAN_CURVE_SPEEDS};
+	uint8 speed = FanControl_getCurveSpeed (&curve, LM_35_readTemp ());
+
+	(void)state;
+	if (speed > DC_MIN_SPEED)
+	{
+		DcMotor_rotate (CW, speed);
+	}
+	else
+	{
+		DcMotor_stop ();
+	}
+}
+
+/* Relay tuning around the PID setpoint of fan_curve.h, then the PID with the tuned gains */
+static void ClosedLoop_autotuneReset (void * state)
+{
+	((ClosedLoop_AutotuneType *)state)->tuned = FALSE;
+	FanControl_setFeedForward (FAN_FEEDFORWARD);
+	FanControl_init ();
+	Autotune_start (FAN_PID_SETPOINT);
+}
+
+static void ClosedLoop_autotuneStep (void * state)
+{
+	ClosedLoop_AutotuneType * tune = (ClosedLoop_AutotuneType *)state;
+	sint16 temperature = LM_35_sensorInterface.convert (LM_35_sensorInterface.read (LM_35_SENSOR_CHANNEL));
+	Autotune_ResultType result;
+
+	if (Autotune_getState () == AUTOTUNE_RUNNING)
+	{
+		FanControl_apply (Autotune_update (temperature));
+		return;
+	}
+	if ((!tune->tuned) && Autotune_getResult (&result))
+	{
+		fprintf (stderr, "autotune: Pu %.0f s, a %.2f C, Ku %.2f %%/C, kp %.3f ki %.6f kd %.3f\n",
+				result.periodTicks * (SYS_TICK_PERIOD_MS / 1000.0), result.amplitude / 256.0,
+				result.ultimateGain / 65536.0, result.gains.kp / 65536.0, result.gains.ki / 65536.0,
+				result.gains.kd / 65536.0);
+		Pid_init (&tune->pid, &result.gains, FAN_PID_SETPOINT);
+		tune->nextPidTick = SysTick_getTicks ();
+		tune->tuned = TRUE;
+	}
+	if (tune->tuned)
+	{
+		if ((sint32)(SysTick_getTicks () - tune->nextPidTick) >= 0)
+		{
+			tune->nextPidTick += SYS_TICK_MS_TO_TICKS (PID_PERIOD_MS);
+			tune->pidSpeed = Pid_update (&tune->pid, (temperature + 128) >> 8);
+		}
+		FanControl_apply (tune->pidSpeed);
+	}
+	else
+	{
+		/* The tuning failed, fall back to the firmware policy */
+		FanControl_update ((temperature + 128) >> 8);
+	}
+}
+
+/* Reference proportional curve: 0 % at 30 C rising linearly to 100 % at 120 C */
+static void ClosedLoop_linearStep (void * state)
+{
+	sint16 speed = ((sint16)LM_35_readTemp () - 30) * 100 / 90;
+
+	(void)state;
+	if (speed <= 0)
+	{
+		DcMotor_stop ();
+	}
+	else
+	{
+		DcMotor_rotate (CW, (speed > DC_MAX_SPEED) ? DC_MAX_SPEED : (uint8)speed);
+	}
+}
+
+static const ClosedLoop_StrategyType g_strategies[] = {
+	{ "firmware",    "policy of fan_curve.h (FanControl_update)",  ClosedLoop_firmwareReset,    ClosedLoop_firmwareStep },
+	{ "feedforward", "firmware policy with the feed-forward term", ClosedLoop_feedForwardReset, ClosedLoop_firmwareStep },
+	{ "adaptive",    "firmware policy on the adaptive sampling",   ClosedLoop_adaptiveReset,    ClosedLoop_adaptiveStep },
+	{ "autotune",    "relay tuning then PID with the tuned gains", ClosedLoop_autotuneReset,    ClosedLoop_autotuneStep },
+	{ "ladder",      "fan curve without feed-forward",             NULL_PTR,                    ClosedLoop_ladderStep },
+	{ "off",         "fan always stopped",                         NULL_PTR,                    ClosedLoop_offStep },
+	{ "full",        "fan always at full speed",                   NULL_PTR,                    ClosedLoop_fullStep },
+	{ "linear",      "0 % at 30 C to 100 % at 120 C",              NULL_PTR,                    ClosedLoop_linearStep },
+};
+
+#define CLOSED_LOOP_NUM_OF_STRATEGIES            (sizeof(g_strategies) / sizeof(g_strategies[0]))
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* xorshift32, each run owns its state so runs are reproducible and thread safe */
+static float64 ClosedLoop_uniform (uint32 * state)
+{
+	uint32 x = *state;
+	x ^= (x << 13) & 0xFFFFFFFFUL;
+	x ^= x >> 17;
+	x ^= (x << 5) & 0xFFFFFFFFUL;
+	*state = x & 0xFFFFFFFFUL;
+	return ((*state) + 1.0) / 4294967297.0;
+}
+
+static float64 ClosedLoop_gaussian (uint32 * state)
+{
+	float64 u1 = ClosedLoop_uniform (state);
+	float64 u2 = ClosedLoop_uniform (state);
+	return sqrt (-2.0 * log (u1)) * cos (2.0 * M_PI * u2);
+}
+
+/* ADC of the host board: the LM35 voltage of the modeled temperature on its channel */
+static uint16 ClosedLoop_adcRead (void * context, uint8 channelNum)
+{
+	ClosedLoop_SensorType * sensor = (ClosedLoop_SensorType *)context;
+	float64 temperature = sensor->plant.temperature;
+	float64 code;
+
+	if (channelNum != LM_35_SENSOR_CHANNEL)
+	{
+		return 0;
+	}
+	if (sensor->noiseSigma > 0.0)
+	{
+		temperature += sensor->noiseSigma * ClosedLoop_gaussian (&sensor->rngState);
+	}
+	code = ThermalPlant_lm35Millivolts (temperature) / (1000.0 * ADC_VOLTAGE_REFERENCE) * (ADC_MAX_DIGITAL_VALUE + 1);
+	code = (code >= ADC_MAX_DIGITAL_VALUE) ? ADC_MAX_DIGITAL_VALUE : (uint16)code;
+	if (sensor->adcTrace != NULL_PTR)
+	{
+		AdcTrace_writeSample (sensor->adcTrace, sensor->timeMs, channelNum, (uint16)code);
+	}
+	return (uint16)code;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Fill the configuration with the default values (50 ms loop, 2 C band, no noise).
+ */
+void ClosedLoop_defaultConfig (ClosedLoop_ConfigType * Config_Ptr)
+{
+	memset (Config_Ptr, 0, sizeof(*Config_Ptr));
+	Config_Ptr->controlPeriod = 0.05;
+	Config_Ptr->plantStep = 0.05;
+	Config_Ptr->initialTemperature = 25.0;
+	Config_Ptr->settleBand = 2.0;
+	Config_Ptr->noiseSigma = 0.0;
+	Config_Ptr->seed = 1;
+	Config_Ptr->trace = NULL_PTR;
+	Config_Ptr->traceInterval = 10.0;
+	Config_Ptr->adcTrace = NULL_PTR;
+}
+
+/*
+ * Description :
+ * Run the strategy against the plant over the whole scenario and compute the
+ * metrics. The calling thread gets its own host board for the run.
+ * Returns FALSE if the run could not be done.
+ */
+bool ClosedLoop_run (const ClosedLoop_ConfigType * Config_Ptr, const ThermalScenario_Type * scenario,
+		const ClosedLoop_StrategyType * strategy, void * strategyState, ClosedLoop_ResultType * Result_Ptr)
+{
+	HostBoard_Type board;
+	ClosedLoop_SensorType sensor;
+	uint64 localState[CLOSED_LOOP_MAX_STATE_SIZE / sizeof(uint64)];
+	uint32 numOfSteps = (uint32)ceil (scenario->duration / Config_Ptr->controlPeriod);
+	uint32 substeps = (uint32)ceil (Config_Ptr->controlPeriod / Config_Ptr->plantStep);
+	float64 substep = Config_Ptr->controlPeriod / substeps;
+	float32 * temperatures;
+	float64 lastDuty = 0.0;
+	float64 dutySum = 0.0;
+	float64 nextTrace = 0.0;
+	uint32 finalStart;
+	uint32 step, i;
+	uint16 segmentIndex = 0;
+
+	temperatures = malloc (numOfSteps * sizeof(float32));
+	if ((temperatures == NULL_PTR) || (numOfSteps == 0))
+	{
+		free (temperatures);
+		return FALSE;
+	}
+	memset (Result_Ptr, 0, sizeof(*Result_Ptr));
+
+	ThermalPlant_init (&sensor.plant, Config_Ptr->initialTemperature);
+	sensor.noiseSigma = Config_Ptr->noiseSigma;
+	sensor.rngState = (Config_Ptr->seed != 0) ? Config_Ptr->seed : 1;
+	sensor.adcTrace = Config_Ptr->adcTrace;
+	sensor.timeMs = 0;
+
+	if (strategyState == NULL_PTR)
+	{
+		memset (localState, 0, sizeof(localState));
+		strategyState = localState;
+	}
+	HostBoard_bind (&board, ClosedLoop_adcRead, &sensor);
+	DcMotor_init ();
+	if (strategy->reset != NULL_PTR)
+	{
+		strategy->reset (strategyState);
+	}
+	Result_Ptr->peakTemperature = sensor.plant.temperature;
+
+	if (Config_Ptr->trace != NULL_PTR)
+	{
+		fprintf (Config_Ptr->trace, "time_s,temperature_C,duty_pct,heat_W,ambient_C\n");
+	}
+	if (Config_Ptr->adcTrace != NULL_PTR)
+	{
+		AdcTrace_writeHeader (Config_Ptr->adcTrace);
+	}
+
+	for (step = 0; step < numOfSteps; step++)
+	{
+		float64 time = step * Config_Ptr->controlPeriod;
+		const ThermalSegment_Type * load = ThermalScenario_at (scenario, time, &segmentIndex);
+		float64 duty;
+
+		sensor.timeMs = (uint32)(time * 1000.0 + 0.5);
+		board.ticks = sensor.timeMs / SYS_TICK_PERIOD_MS;  /* Same tick as a replay of the ADC trace */
+		strategy->step (strategyState);                /* One superloop iteration */
+		duty = HostBoard_getFanDuty (&board);
+
+		if (fabs (duty - lastDuty) > 1e-9)
+		{
+			Result_Ptr->dutyChanges++;
+			Result_Ptr->dutyChurn += fabs (duty - lastDuty) * 100.0;
+			lastDuty = duty;
+		}
+		dutySum += duty;
+
+		for (i = 0; i < substeps; i++)
+		{
+			ThermalPlant_step (&sensor.plant, load, duty, substep);
+		}
+		Result_Ptr->energy += ThermalPlant_fanPower (&sensor.plant, duty) * Config_Ptr->controlPeriod;
+
+		temperatures[step] = (float32)sensor.plant.temperature;
+		if (sensor.plant.temperature > Result_Ptr->peakTemperature)
+		{
+			Result_Ptr->peakTemperature = sensor.plant.temperature;
+		}
+
+		if ((Config_Ptr->trace != NULL_PTR) && (time >= nextTrace))
+		{
+			fprintf (Config_Ptr->trace, "%.2f,%.3f,%.2f,%.2f,%.2f\n", time, sensor.plant.temperature,
+					duty * 100.0, load->heatPower, load->ambient);
+			nextTrace += Config_Ptr->traceInterval;
+		}
+	}
+
+	/* Final value: mean of the last tenth of the run */
+	finalStart = numOfSteps - (uint32)ceil (numOfSteps * CLOSED_LOOP_FINAL_FRACTION);
+	for (step = finalStart; step < numOfSteps; step++)
+	{
+		Result_Ptr->finalTemperature += temperatures[step];
+	}
+	Result_Ptr->finalTemperature /= (numOfSteps - finalStart);
+
+	/* Settling time: end of the last step spent outside the band around the final value */
+	for (step = numOfSteps; step > 0; step--)
+	{
+		if (fabs (temperatures[step - 1] - Result_Ptr->finalTemperature) > Config_Ptr->settleBand)
+		{
+			break;
+		}
+	}
+	Result_Ptr->settlingTime = step * Config_Ptr->controlPeriod;
+
+	Result_Ptr->overshoot = Result_Ptr->peakTemperature - Result_Ptr->finalTemperature;
+	if (Result_Ptr->overshoot < 0.0)
+	{
+		Result_Ptr->overshoot = 0.0;
+	}
+	Result_Ptr->simulatedTime = numOfSteps * Config_Ptr->controlPeriod;
+	Result_Ptr->meanDuty = dutySum * 100.0 / numOfSteps;
+	Result_Ptr->controlSteps = numOfSteps;
+	Result_Ptr->pwmWrites = board.pwmWrites;
+	Result_Ptr->adcConversions = board.adcConversions;
+
+	free (temperatures);
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Return the strategy registered with the given name, NULL_PTR if unknown.
+ */
+const ClosedLoop_StrategyType * ClosedLoop_findStrategy (const char * name)
+{
+	uint8 i;
+
+	for (i = 0; i < CLOSED_LOOP_NUM_OF_STRATEGIES; i++)
+	{
+		if (strcmp (g_strategies[i].name, name) == 0)
+		{
+			return &g_strategies[i];
+		}
+	}
+	return NULL_PTR;
+}
+
+/*
+ * Description :
+ * Return the registered strategy at the given index, NULL_PTR past the last one.
+ */
+const ClosedLoop_StrategyType * ClosedLoop_getStrategy (uint8 index)
+{
+	return (index < CLOSED_LOOP_NUM_OF_STRATEGIES) ? &g_strategies[index] : NULL_PTR;
+}
+
+/*
+ * Description :
+ * Print the names and descriptions of all the registered strategies.
+ */
+void ClosedLoop_listStrategies (FILE * stream)
+{
+	uint8 i;
+
+	for (i = 0; i < CLOSED_LOOP_NUM_OF_STRATEGIES; i++)
+	{
+		fprintf (stream, "  %-11s %s\n", g_strategies[i].name, g_strategies[i].description);
+	}
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+ *
+ * Module: CLOSED_LOOP
+ *
+ * File Name: closed_loop.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the closed-loop run of a fan control strategy
+ *              against the thermal plant, through the host board drivers.
+ *
+ *******************************************************************************/
+
+#ifndef CLOSED_LOOP_H_
+#define CLOSED_LOOP_H_
+
+#include <stdio.h>
+#include "std_types.h"
+#include "thermal_plant.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Largest state a strategy may keep in the state buffer of a run */
+#define CLOSED_LOOP_MAX_STATE_SIZE               256
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/*
+ * A control strategy runs one superloop iteration: it reads the sensor and
+ * drives the fan only through the firmware driver API (LM_35, DcMotor, ...).
+ * Any state lives in the state buffer given to the run, never in globals.
+ */
+typedef struct{
+	const char * name;
+	const char * description;
+	void (*reset)(void * state);
+	void (*step)(void * state);
+} ClosedLoop_StrategyType;
+
+typedef struct{
+	float64 controlPeriod;             /* s, period of one superloop iteration */
+	float64 plantStep;                 /* s, integration step of the plant */
+	float64 initialTemperature;        /* C */
+	float64 settleBand;                /* C, band around the final value for the settling time */
+	float64 noiseSigma;                /* C, standard deviation of the LM35 noise */
+	uint32 seed;                       /* Seed of the noise generator */
+	FILE * trace;                      /* Optional CSV trace, NULL_PTR to disable */
+	float64 traceInterval;             /* s between two trace lines */
+	FILE * adcTrace;                   /* Optional trace of every raw ADC code (adc_trace.h), NULL_PTR to disable */
+} ClosedLoop_ConfigType;
+
+typedef struct{
+	float64 simulatedTime;             /* s */
+	float64 finalTemperature;          /* C, mean over the last tenth of the run */
+	float64 peakTemperature;           /* C */
+	float64 overshoot;                 /* C above the final value */
+	float64 settlingTime;              /* s, last exit from the settle band */
+	float64 meanDuty;                  /* % */
+	float64 dutyChurn;                 /* %, sum of the absolute duty changes */
+	float64 energy;                    /* J used by the fan */
+	uint32 dutyChanges;
+	uint32 controlSteps;
+	uint32 pwmWrites;
+	uint32 adcConversions;
+} ClosedLoop_ResultType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Fill the configuration with the default values (50 ms loop, 2 C band, no noise).
+ */
+void ClosedLoop_defaultConfig (ClosedLoop_ConfigType * Config_Ptr);
+
+/*
+ * Description :
+ * Run the strategy against the plant over the whole scenario and compute the
+ * metrics. The calling thread gets its own host board for the run.
+ * Returns FALSE if the run could not be done.
+ */
+bool ClosedLoop_run (const ClosedLoop_ConfigType * Config_Ptr, const ThermalScenario_Type * scenario,
+		const ClosedLoop_StrategyType * strategy, void * strategyState, ClosedLoop_ResultType * Result_Ptr);
+
+/*
+ * Description :
+ * Return the strategy registered with the given name, NULL_PTR if unknown.
+ */
+const ClosedLoop_StrategyType * ClosedLoop_findStrategy (const char * name);
+
+/*
+ * Description :
+ * Return the registered strategy at the given index, NULL_PTR past the last one.
+ */
+const ClosedLoop_StrategyType * ClosedLoop_getStrategy (uint8 index);
+
+/*
+ * Description :
+ * Print the names and descriptions of all the registered strategies.
+ */
+void ClosedLoop_listStrategies (FILE * stream);
+
+#endif /* CLOSED_LOOP_H_ */
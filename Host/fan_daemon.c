@@ -0,0 +1,234 @@
+/******************************************************************************
+ *
+ * Module: FAN_DAEMON
+ *
+ * File Name: fan_daemon.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Linux daemon running the firmware control loop of main.c
+ *              (LM_35 -> FAN_CONTROL -> DC_MOTOR) against a hwmon directory.
+ *              The loop is paced by a timerfd and a signalfd ends it, both
+ *              waited on with poll, and the temperature and pwm attributes stay
+ *              open for the whole run.
+ *
+ * Usage: fan_daemon --hwmon-dir DIR [options]
+ *        -d, --hwmon-dir DIR    hwmon directory, e.g. /sys/class/hwmon/hwmon2 or a fake tree
+ *        -t, --temp N           temperature attribute temp<N>_input (default 1)
+ *        -p, --pwm N            fan attribute pwm<N> (default 1)
+ *        -i, --interval MS      control loop period, a multiple of 10 ms (default 1000)
+ *        -m, --min-speed PCT    lowest fan speed in percent (default 0)
+ *        -n, --count N          exit after N loop iterations (default: run until a signal)
+ *        -v, --verbose          print every change of the pwm value
+ *
+ *******************************************************************************/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include "hwmon_board.h"
+#include "lm_35.h"
+#include "dc_motor.h"
+#include "fan_control.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static const struct option g_options[] = {
+	{"hwmon-dir", required_argument, NULL_PTR, 'd'},
+	{"temp",      required_argument, NULL_PTR, 't'},
+	{"pwm",       required_argument, NULL_PTR, 'p'},
+	{"interval",  required_argument, NULL_PTR, 'i'},
+	{"min-speed", required_argument, NULL_PTR, 'm'},
+	{"count",     required_argument, NULL_PTR, 'n'},
+	{"verbose",   no_argument,       NULL_PTR, 'v'},
+	{"help",      no_argument,       NULL_PTR, 'h'},
+	{NULL_PTR,    0,                 NULL_PTR, 0}
+};
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void FanDaemon_usage (const char * program)
+{
+	fprintf (stderr, "usage: %s --hwmon-dir DIR [--temp N] [--pwm N] [--interval ms] [--min-speed pct]\n"
+			"       [--count N] [--verbose]\n", program);
+}
+
+/* Timer of the control loop, the first expiration is immediate */
+static int FanDaemon_openTimer (uint32 intervalMs)
+{
+	struct itimerspec period;
+	int fd = timerfd_create (CLOCK_MONOTONIC, TFD_CLOEXEC);
+
+	if (fd < 0)
+	{
+		return -1;
+	}
+	period.it_interval.tv_sec = intervalMs / 1000;
+	period.it_interval.tv_nsec = (long)(intervalMs % 1000) * 1000000L;
+	period.it_value.tv_sec = 0;
+	period.it_value.tv_nsec = 1;
+	if (timerfd_settime (fd, 0, &period, NULL_PTR) != 0)
+	{
+		close (fd);
+		return -1;
+	}
+	return fd;
+}
+
+/* The termination signals are read from a descriptor, so the loop always exits through the pwm restore */
+static int FanDaemon_openSignals (void)
+{
+	sigset_t signals;
+
+	sigemptyset (&signals);
+	sigaddset (&signals, SIGINT);
+	sigaddset (&signals, SIGTERM);
+	sigaddset (&signals, SIGHUP);
+	if (sigprocmask (SIG_BLOCK, &signals, NULL_PTR) != 0)
+	{
+		return -1;
+	}
+	return signalfd (-1, &signals, SFD_CLOEXEC);
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (int argc, char * argv[])
+{
+	static HwmonBoard_Type hwmon;
+	const char * directory = NULL_PTR;
+	uint8 tempIndex = 1;
+	uint8 pwmIndex = 1;
+	uint32 intervalMs = 1000;
+	uint8 minSpeed = 0;
+	long remaining = -1;
+	bool verbose = FALSE;
+	struct pollfd fds[2];
+	uint32 iterations = 0;
+	uint32 overruns = 0;
+	int status = 0;
+	int opt;
+
+	while ((opt = getopt_long (argc, argv, "d:t:p:i:m:n:vh", g_options, NULL_PTR)) != -1)
+	{
+		switch (opt)
+		{
+		case 'd': directory = optarg; break;
+		case 't': tempIndex = (uint8)strtoul (optarg, NULL_PTR, 0); break;
+		case 'p': pwmIndex = (uint8)strtoul (optarg, NULL_PTR, 0); break;
+		case 'i': intervalMs = (uint32)strtoul (optarg, NULL_PTR, 0); break;
+		case 'm': minSpeed = (uint8)strtoul (optarg, NULL_PTR, 0); break;
+		case 'n': remaining = strtol (optarg, NULL_PTR, 0); break;
+		case 'v': verbose = TRUE; break;
+		default:
+			FanDaemon_usage (argv[0]);
+			return 2;
+		}
+	}
+	if ((directory == NULL_PTR) || (intervalMs == 0) || ((intervalMs % SYS_TICK_PERIOD_MS) != 0))
+	{
+		FanDaemon_usage (argv[0]);
+		return 2;
+	}
+
+	fds[0].fd = FanDaemon_openTimer (intervalMs);
+	fds[1].fd = FanDaemon_openSignals ();
+	if ((fds[0].fd < 0) || (fds[1].fd < 0))
+	{
+		perror ("timer");
+		return 1;
+	}
+	fds[0].events = POLLIN;
+	fds[1].events = POLLIN;
+
+	if (!HwmonBoard_open (&hwmon, directory, tempIndex, pwmIndex))
+	{
+		fprintf (stderr, "%s: temp%u_input / pwm%u: %s\n", directory, tempIndex, pwmIndex, strerror (errno));
+		return 1;
+	}
+
+	/* Same initialization as the boot of main.c */
+	DcMotor_init ();
+	FanControl_init ();
+	FanControl_setMinSpeed (minSpeed);
+	printf ("fan daemon on %s: temp%u_input -> pwm%u every %lu ms\n", directory, tempIndex, pwmIndex,
+			(unsigned long)intervalMs);
+	fflush (stdout);
+
+	while (remaining != 0)
+	{
+		uint64_t expirations;
+		sint32 lastPwm;
+		uint8 speed;
+
+		if (poll (fds, 2, -1) < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			perror ("poll");
+			status = 1;
+			break;
+		}
+		if (fds[1].revents & POLLIN)
+		{
+			break;
+		}
+		if ((fds[0].revents & POLLIN) == 0)
+		{
+			continue;
+		}
+		if (read (fds[0].fd, &expirations, sizeof(expirations)) != sizeof(expirations))
+		{
+			continue;
+		}
+
+		/* A late iteration still advances the system tick by every period that elapsed */
+		if (expirations > 1)
+		{
+			overruns += (uint32)(expirations - 1);
+		}
+		HwmonBoard_advance (&hwmon, (uint32)expirations * intervalMs);
+
+		lastPwm = hwmon.writtenPwm;
+		speed = FanControl_update (LM_35_readTemp ());
+		if (!HwmonBoard_sync (&hwmon))
+		{
+			perror ("pwm");
+		}
+		if (verbose && (hwmon.writtenPwm != lastPwm))
+		{
+			printf ("%8.1f C  speed %3u %%  pwm %3ld\n", hwmon.temperature / 1000.0, speed, (long)hwmon.writtenPwm);
+			fflush (stdout);
+		}
+
+		iterations++;
+		if (remaining > 0)
+		{
+			remaining--;
+		}
+	}
+
+	printf ("%lu iterations, %lu overruns, %lu temperature reads (%lu failed), %lu pwm writes (%lu failed)\n",
+			(unsigned long)iterations, (unsigned long)overruns, (unsigned long)hwmon.tempReads,
+			(unsigned long)hwmon.readErrors, (unsigned long)hwmon.pwmWrites, (unsigned long)hwmon.writeErrors);
+	HwmonBoard_close (&hwmon);
+	close (fds[0].fd);
+	close (fds[1].fd);
+	return status;
+}
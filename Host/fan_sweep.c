@@ -0,0 +1,545 @@
+/******************************************************************************
+ *
+ * Module: FAN_SWEEP
+ *
+ * File Name: fan_sweep.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Parallel parameter sweep of the fan curve and of the PID gains.
+ *              Every candidate runs the firmware FAN_CONTROL / PID modules in the
+ *              closed-loop simulator against all the scenarios, the candidates
+ *              are spread over a pool of worker threads (one simulator instance
+ *              per run, results written to the candidate's own slot), ranked by
+ *              overshoot, energy and duty churn, and the winner is emitted as a
+ *              fan_curve.h the firmware can include.
+ *
+ * Usage: fan_sweep [options]
+ *        -j N      worker threads (default: all online cores)
+ *        -f FILE   recorded scenario, can be repeated (default: step, pulse and ramp)
+ *        -t SEC    simulated duration of every scenario (default 7200)
+ *        -P WATT   heat load of the synthetic scenarios (default 40)
+ *        -a DEG    ambient temperature of the synthetic scenarios (default 25)
+ *        -p SEC    control loop period, the simulated PID gains are per period and the
+ *                  written header converts them to PID_PERIOD_MS updates (default 0.05)
+ *        -L DEG    temperature limit, every degree above it costs 1000 points (default 65)
+ *        -O W      weight of one degree of overshoot (default 1)
+ *        -E W      weight of one kJ of fan energy (default 1)
+ *        -C W      weight of 100 % of duty churn (default 1)
+ *        -k N      number of ranked candidates printed (default 10)
+ *        -o FILE   write the winning configuration as a fan_curve.h header
+ *
+ *******************************************************************************/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "closed_loop.h"
+#include "fan_control.h"
+#include "pid_controller.h"
+#include "lm_35.h"
+#include "dc_motor.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define SWEEP_MAX_SCENARIOS                      8
+#define SWEEP_LIMIT_PENALTY                      1000.0
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef enum
+{
+	SWEEP_KIND_CURVE, SWEEP_KIND_PID
+} Sweep_KindType;
+
+typedef struct{
+	Sweep_KindType kind;
+	FanControl_CurveType curve;
+	sint16 setpoint;
+	float64 kp;                        /* %/C */
+	float64 ki;                        /* %/(C.s) */
+	float64 kd;                        /* %.s/C */
+	Pid_GainsType gains;               /* Q16.16 per loop iteration */
+} Sweep_CandidateType;
+
+typedef struct{
+	float64 score;
+	float64 overshoot;                 /* C, worst over the scenarios */
+	float64 peak;                      /* C, worst over the scenarios */
+	float64 energy;                    /* J, sum over the scenarios */
+	float64 churn;                     /* %, sum over the scenarios */
+	bool valid;
+} Sweep_ResultType;
+
+/* Per run strategy state, lives on the worker stack */
+typedef struct{
+	const Sweep_CandidateType * candidate;
+	Pid_ControllerType pid;
+} Sweep_StateType;
+
+/* Read-only inputs shared by the workers plus the only shared mutable item, the atomic job counter */
+typedef struct{
+	const ClosedLoop_ConfigType * config;
+	const ThermalScenario_Type * scenarios;
+	uint8 numOfScenarios;
+	const Sweep_CandidateType * candidates;
+	Sweep_ResultType * results;
+	uint32 numOfCandidates;
+	float64 limit;
+	float64 weightOvershoot;
+	float64 weightEnergy;
+	float64 weightChurn;
+	uint32 nextJob;
+} Sweep_JobsType;
+
+/*******************************************************************************
+ *                      Strategy Definitions                                   *
+ *******************************************************************************/
+static void Sweep_reset (void * state)
+{
+	Sweep_StateType * sweep = (Sweep_StateType *)state;
+
+	if (sweep->candidate->kind == SWEEP_KIND_PID)
+	{
+		Pid_init (&sweep->pid, &sweep->candidate->gains, sweep->candidate->setpoint);
+	}
+}
+
+static void Sweep_step (void * state)
+{
+	Sweep_StateType * sweep = (Sweep_StateType *)state;
+	uint8 temperature = LM_35_readTemp ();
+	uint8 speed;
+
+	if (sweep->candidate->kind == SWEEP_KIND_PID)
+	{
+		speed = Pid_update (&sweep->pid, (sint16)temperature);
+	}
+	else
+	{
+		speed = FanControl_getCurveSpeed (&sweep->candidate->curve, temperature);
+	}
+
+	if (speed > DC_MIN_SPEED)
+	{
+		DcMotor_rotate (CW, speed);
+	}
+	else
+	{
+		DcMotor_stop ();
+	}
+}
+
+static const ClosedLoop_StrategyType g_sweepStrategy = { "sweep", "candidate under test", Sweep_reset, Sweep_step };
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Build the candidate grid: fan curves with evenly spaced thresholds and
+ * speeds rising linearly to 100 %, and PID controllers.
+ * Returns the number of candidates written (up to maxCandidates).
+ */
+static uint32 Sweep_buildCandidates (Sweep_CandidateType * candidates, uint32 maxCandidates, float64 period)
+{
+	static const uint8 firstThresholds[] = {25, 30, 35, 40, 45, 50};
+	static const uint8 spacings[] = {3, 5, 8, 10, 15, 20, 30};
+	static const uint8 firstSpeeds[] = {10, 20, 25, 35, 50};
+	static const sint16 setpoints[] = {45, 50, 55, 60, 65};
+	static const float64 kps[] = {2.0, 4.0, 8.0, 16.0, 32.0};
+	static const float64 kis[] = {0.0, 0.005, 0.01, 0.02, 0.05, 0.1};
+	static const float64 kds[] = {0.0, 10.0, 50.0};
+	uint32 count = 0;
+	uint8 a, b, c, d;
+	uint8 i;
+
+#define SWEEP_COUNT_OF(ARRAY) (sizeof(ARRAY) / sizeof((ARRAY)[0]))
+
+	for (a = 0; a < SWEEP_COUNT_OF (firstThresholds); a++)
+		for (b = 0; b < SWEEP_COUNT_OF (spacings); b++)
+			for (c = 0; c < SWEEP_COUNT_OF (firstSpeeds); c++)
+			{
+				Sweep_CandidateType * candidate = &candidates[count];
+				if ((count == maxCandidates) ||
+						(firstThresholds[a] + (FAN_CURVE_NUM_OF_POINTS - 1) * spacings[b] > LM_35_MAX_TEMPERATURE))
+				{
+					continue;
+				}
+				memset (candidate, 0, sizeof(*candidate));
+				candidate->kind = SWEEP_KIND_CURVE;
+				for (i = 0; i < FAN_CURVE_NUM_OF_POINTS; i++)
+				{
+					candidate->curve.thresholds[i] = (uint8)(firstThresholds[a] + i * spacings[b]);
+					candidate->curve.speeds[i] = (uint8)(firstSpeeds[c] +
+							(DC_MAX_SPEED - firstSpeeds[c]) * i / (FAN_CURVE_NUM_OF_POINTS - 1));
+				}
+				count++;
+			}
+
+	for (a = 0; a < SWEEP_COUNT_OF (setpoints); a++)
+		for (b = 0; b < SWEEP_COUNT_OF (kps); b++)
+			for (c = 0; c < SWEEP_COUNT_OF (kis); c++)
+				for (d = 0; d < SWEEP_COUNT_OF (kds); d++)
+				{
+					Sweep_CandidateType * candidate = &candidates[count];
+					if (count == maxCandidates)
+					{
+						continue;
+					}
+					memset (candidate, 0, sizeof(*candidate));
+					candidate->kind = SWEEP_KIND_PID;
+					candidate->setpoint = setpoints[a];
+					candidate->kp = kps[b];
+					candidate->ki = kis[c];
+					candidate->kd = kds[d];
+					/* Continuous time gains to per loop iteration gains */
+					candidate->gains.kp = PID_GAIN (kps[b]);
+					candidate->gains.ki = PID_GAIN (kis[c] * period);
+					candidate->gains.kd = PID_GAIN (kds[d] / period);
+					count++;
+				}
+	return count;
+}
+
+/*
+ * Description :
+ * Worker thread: take the next candidate index from the shared atomic counter,
+ * run it against every scenario and store the result in its own slot.
+ */
+static void * Sweep_worker (void * argument)
+{
+	Sweep_JobsType * jobs = (Sweep_JobsType *)argument;
+	uint32 index;
+
+	while ((index = __atomic_fetch_add (&jobs->nextJob, 1, __ATOMIC_RELAXED)) < jobs->numOfCandidates)
+	{
+		Sweep_ResultType result;
+		Sweep_StateType state;
+		uint8 i;
+
+		memset (&result, 0, sizeof(result));
+		result.valid = TRUE;
+		state.candidate = &jobs->candidates[index];
+
+		for (i = 0; i < jobs->numOfScenarios; i++)
+		{
+			ClosedLoop_ResultType run;
+			if (!ClosedLoop_run (jobs->config, &jobs->scenarios[i], &g_sweepStrategy, &state, &run))
+			{
+				result.valid = FALSE;
+				break;
+			}
+			result.overshoot = (run.overshoot > result.overshoot) ? run.overshoot : result.overshoot;
+			result.peak = (run.peakTemperature > result.peak) ? run.peakTemperature : result.peak;
+			result.energy += run.energy;
+			result.churn += run.dutyChurn;
+			result.score += (jobs->weightOvershoot * run.overshoot) + (jobs->weightEnergy * run.energy / 1000.0) +
+					(jobs->weightChurn * run.dutyChurn / 100.0);
+			if (run.peakTemperature > jobs->limit)
+			{
+				result.score += SWEEP_LIMIT_PENALTY * (run.peakTemperature - jobs->limit);
+			}
+		}
+		jobs->results[index] = result;
+	}
+	return NULL;
+}
+
+static void Sweep_describe (const Sweep_CandidateType * candidate, char * text, size_t size)
+{
+	if (candidate->kind == SWEEP_KIND_CURVE)
+	{
+		snprintf (text, size, "curve %u/%u/%u/%u C -> %u/%u/%u/%u %%",
+				candidate->curve.thresholds[0], candidate->curve.thresholds[1],
+				candidate->curve.thresholds[2], candidate->curve.thresholds[3],
+				candidate->curve.speeds[0], candidate->curve.speeds[1],
+				candidate->curve.speeds[2], candidate->curve.speeds[3]);
+	}
+	else
+	{
+		snprintf (text, size, "pid sp=%d kp=%g ki=%g kd=%g", candidate->setpoint,
+				candidate->kp, candidate->ki, candidate->kd);
+	}
+}
+
+static void Sweep_printList (FILE * file, const uint8 * values)
+{
+	uint8 i;
+
+	fprintf (file, "{");
+	for (i = 0; i < FAN_CURVE_NUM_OF_POINTS; i++)
+	{
+		fprintf (file, "%s%u", (i == 0) ? "" : ", ", values[i]);
+	}
+	fprintf (file, "}");
+}
+
+/*
+ * Description :
+ * Write the fan_curve.h header with the best curve and the best PID gains,
+ * selecting the control mode of the overall winner.
+ */
+static bool Sweep_writeHeader (const char * path, const Sweep_CandidateType * winner,
+		const Sweep_CandidateType * bestCurve, const Sweep_CandidateType * bestPid, float64 period)
+{
+	FILE * file = fopen (path, "w");
+	time_t now = time (NULL);
+	char date[32];
+
+	if (file == NULL)
+	{
+		perror (path);
+		return FALSE;
+	}
+	strftime (date, sizeof(date), "%b %d, %Y", localtime (&now));
+
+	fprintf (file,
+			"/******************************************************************************\n"
+			" *\n"
+			" * Module: FAN_CONTROL\n"
+			" *\n"
+			" * File Name: fan_curve.h\n"
+			" *\n"
+			" * Author: Host/fan_sweep\n"
+			" *\n"
+			" * Date Created: %s\n"
+			" *\n"
+			" * Description: Static configuration of the fan curve used by the fan control module,\n"
+			" *              generated by a parameter sweep at a %.3f s loop period\n"
+			" *\n"
+			" *******************************************************************************/\n\n"
+			"#ifndef FAN_CURVE_H_\n#define FAN_CURVE_H_\n\n"
+			"/*******************************************************************************\n"
+			" *                                Definitions                                  *\n"
+			" *******************************************************************************/\n\n"
+			"/* Static Configurations */\n"
+			"#define FAN_CURVE_NUM_OF_POINTS                  %u\n\n"
+			"/* Temperature thresholds in Celsius (ascending) and the fan speed in percent from each one */\n"
+			"#define FAN_CURVE_THRESHOLDS                     ", date, period, FAN_CURVE_NUM_OF_POINTS);
+	Sweep_printList (file, bestCurve->curve.thresholds);
+	fprintf (file, "\n#define FAN_CURVE_SPEEDS                         ");
+	Sweep_printList (file, bestCurve->curve.speeds);
+	fprintf (file,
+			"\n\n/* FAN_CONTROL_MODE_CURVE follows the fan curve, FAN_CONTROL_MODE_PID regulates around the setpoint */\n"
+			"#define FAN_CONTROL_MODE                         %s\n\n"
+			"/* Setpoint in Celsius and Q16.16 gains per PID_PERIOD_MS update of the PID mode */\n"
+			"#define FAN_PID_SETPOINT                         %d\n"
+			"#define FAN_PID_KP                               PID_GAIN(%.6g)\n"
+			"#define FAN_PID_KI                               PID_GAIN(%.6g)\n"
+			"#define FAN_PID_KD                               PID_GAIN(%.6g)\n\n"
+			"#endif /* FAN_CURVE_H_ */\n",
+			(winner->kind == SWEEP_KIND_PID) ? "FAN_CONTROL_MODE_PID" : "FAN_CONTROL_MODE_CURVE",
+			bestPid->setpoint, bestPid->kp, bestPid->ki * (PID_PERIOD_MS / 1000.0), bestPid->kd / (PID_PERIOD_MS / 1000.0));
+	fclose (file);
+	return TRUE;
+}
+
+static float64 Sweep_now (void)
+{
+	struct timespec now;
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/* Sort helper: the candidate indices are ordered by their score */
+static const Sweep_ResultType * g_sortResults;
+
+static int Sweep_compare (const void * left, const void * right)
+{
+	const Sweep_ResultType * a = &g_sortResults[*(const uint32 *)left];
+	const Sweep_ResultType * b = &g_sortResults[*(const uint32 *)right];
+
+	if (a->valid != b->valid)
+	{
+		return a->valid ? -1 : 1;
+	}
+	return (a->score < b->score) ? -1 : (a->score > b->score) ? 1 : 0;
+}
+
+static void Sweep_usage (const char * program)
+{
+	fprintf (stderr, "usage: %s [-j threads] [-f scenario_file]... [-t sec] [-P W] [-a C] [-p period]\n"
+			"       [-L limit_C] [-O w] [-E w] [-C w] [-k top] [-o fan_curve.h]\n", program);
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (int argc, char * argv[])
+{
+	static ThermalScenario_Type scenarios[SWEEP_MAX_SCENARIOS];
+	static const char * const synthetic[] = {"step", "pulse", "ramp"};
+	const char * files[SWEEP_MAX_SCENARIOS];
+	uint8 numOfFiles = 0;
+	ClosedLoop_ConfigType config;
+	Sweep_JobsType jobs;
+	Sweep_CandidateType * candidates;
+	uint32 * order;
+	pthread_t * threads;
+	long numOfThreads = sysconf (_SC_NPROCESSORS_ONLN);
+	const char * headerPath = NULL_PTR;
+	float64 duration = 7200.0;
+	float64 heatPower = 40.0;
+	float64 ambient = 25.0;
+	float64 start, elapsed;
+	uint32 top = 10;
+	uint32 maxCandidates = 4096;
+	uint32 i;
+	const Sweep_CandidateType * bestCurve = NULL_PTR;
+	const Sweep_CandidateType * bestPid = NULL_PTR;
+	int opt;
+
+	ClosedLoop_defaultConfig (&config);
+	memset (&jobs, 0, sizeof(jobs));
+	jobs.limit = 65.0;
+	jobs.weightOvershoot = 1.0;
+	jobs.weightEnergy = 1.0;
+	jobs.weightChurn = 1.0;
+
+	while ((opt = getopt (argc, argv, "j:f:t:P:a:p:L:O:E:C:k:o:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'j': numOfThreads = atol (optarg); break;
+		case 'f':
+			if (numOfFiles == SWEEP_MAX_SCENARIOS)
+			{
+				fprintf (stderr, "at most %d scenarios\n", SWEEP_MAX_SCENARIOS);
+				return 2;
+			}
+			files[numOfFiles++] = optarg;
+			break;
+		case 't': duration = atof (optarg); break;
+		case 'P': heatPower = atof (optarg); break;
+		case 'a': ambient = atof (optarg); config.initialTemperature = ambient; break;
+		case 'p': config.controlPeriod = atof (optarg); config.plantStep = config.controlPeriod; break;
+		case 'L': jobs.limit = atof (optarg); break;
+		case 'O': jobs.weightOvershoot = atof (optarg); break;
+		case 'E': jobs.weightEnergy = atof (optarg); break;
+		case 'C': jobs.weightChurn = atof (optarg); break;
+		case 'k': top = (uint32)strtoul (optarg, NULL_PTR, 0); break;
+		case 'o': headerPath = optarg; break;
+		default:
+			Sweep_usage (argv[0]);
+			return 2;
+		}
+	}
+	if ((numOfThreads < 1) || (duration <= 0.0) || (config.controlPeriod <= 0.0))
+	{
+		Sweep_usage (argv[0]);
+		return 2;
+	}
+
+	/* Scenarios: the recorded files, or the synthetic set */
+	if (numOfFiles > 0)
+	{
+		for (i = 0; i < numOfFiles; i++)
+		{
+			if (!ThermalScenario_load (&scenarios[i], files[i], duration))
+			{
+				return 2;
+			}
+		}
+		jobs.numOfScenarios = numOfFiles;
+	}
+	else
+	{
+		for (i = 0; i < sizeof(synthetic) / sizeof(synthetic[0]); i++)
+		{
+			ThermalScenario_synthetic (&scenarios[i], synthetic[i], heatPower, ambient, duration);
+		}
+		jobs.numOfScenarios = sizeof(synthetic) / sizeof(synthetic[0]);
+	}
+
+	candidates = calloc (maxCandidates, sizeof(Sweep_CandidateType));
+	jobs.numOfCandidates = Sweep_buildCandidates (candidates, maxCandidates, config.controlPeriod);
+	jobs.results = calloc (jobs.numOfCandidates, sizeof(Sweep_ResultType));
+	order = calloc (jobs.numOfCandidates, sizeof(uint32));
+	threads = calloc ((size_t)numOfThreads, sizeof(pthread_t));
+	if ((candidates == NULL) || (jobs.results == NULL) || (order == NULL) || (threads == NULL))
+	{
+		fprintf (stderr, "out of memory\n");
+		return 2;
+	}
+	jobs.config = &config;
+	jobs.scenarios = scenarios;
+	jobs.candidates = candidates;
+
+	printf ("%lu candidates x %u scenarios of %.0f s on %ld threads\n", (unsigned long)jobs.numOfCandidates,
+			jobs.numOfScenarios, duration, numOfThreads);
+
+	start = Sweep_now ();
+	for (i = 0; i < (uint32)numOfThreads; i++)
+	{
+		if (pthread_create (&threads[i], NULL, Sweep_worker, &jobs) != 0)
+		{
+			fprintf (stderr, "cannot start worker %lu\n", (unsigned long)i);
+			return 2;
+		}
+	}
+	for (i = 0; i < (uint32)numOfThreads; i++)
+	{
+		pthread_join (threads[i], NULL);
+	}
+	elapsed = Sweep_now () - start;
+
+	for (i = 0; i < jobs.numOfCandidates; i++)
+	{
+		order[i] = i;
+	}
+	g_sortResults = jobs.results;
+	qsort (order, jobs.numOfCandidates, sizeof(uint32), Sweep_compare);
+
+	printf ("%.1f s, %.0f simulated s per real s\n", elapsed,
+			jobs.numOfCandidates * jobs.numOfScenarios * duration / elapsed);
+	printf ("%4s %9s %7s %7s %9s %9s  %s\n", "rank", "score", "peak_C", "over_C", "energy_J", "churn_%", "candidate");
+	for (i = 0; i < jobs.numOfCandidates; i++)
+	{
+		const Sweep_CandidateType * candidate = &candidates[order[i]];
+		const Sweep_ResultType * result = &jobs.results[order[i]];
+		char text[96];
+
+		if (!result->valid)
+		{
+			continue;
+		}
+		if ((candidate->kind == SWEEP_KIND_CURVE) && (bestCurve == NULL_PTR))
+		{
+			bestCurve = candidate;
+		}
+		if ((candidate->kind == SWEEP_KIND_PID) && (bestPid == NULL_PTR))
+		{
+			bestPid = candidate;
+		}
+		if (i < top)
+		{
+			Sweep_describe (candidate, text, sizeof(text));
+			printf ("%4lu %9.1f %7.2f %7.2f %9.0f %9.0f  %s\n", (unsigned long)(i + 1), result->score,
+					result->peak, result->overshoot, result->energy, result->churn, text);
+		}
+	}
+
+	if ((headerPath != NULL_PTR) && (bestCurve != NULL_PTR) && (bestPid != NULL_PTR))
+	{
+		if (!Sweep_writeHeader (headerPath, &candidates[order[0]], bestCurve, bestPid, config.controlPeriod))
+		{
+			return 1;
+		}
+		printf ("wrote %s\n", headerPath);
+	}
+
+	free (threads);
+	free (order);
+	free (jobs.results);
+	free (candidates);
+	return 0;
+}
@@ -0,0 +1,197 @@
+/******************************************************************************
+ *
+ * Module: HOST_BOARD
+ *
+ * File Name: host_board.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Host replacement of the ATmega32 drivers (ADC, PWM Timer0, GPIO
+ *              and system tick) with the same prototypes as the firmware drivers, so the
+ *              unmodified application modules link against them on Linux.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include "host_board.h"
+#include "adc.h"
+#include "pwm_timer0.h"
+#include "dc_motor.h"
+#include "sys_tick.h"
+#include "common_macros.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static __thread HostBoard_Type * g_board = NULL_PTR;
+
+/*******************************************************************************
+ *                      Board Functions Definitions                            *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Reset the peripherals of the board and bind it to the calling thread,
+ * all the driver calls of this thread are then served by this board.
+ */
+void HostBoard_bind (HostBoard_Type * board, uint16 (*adcRead)(void * context, uint8 channelNum), void * context)
+{
+	memset (board, 0, sizeof(*board));
+	board->adcRead = adcRead;
+	board->context = context;
+	g_board = board;
+}
+
+/*
+ * Description :
+ * Return the board bound to the calling thread.
+ */
+HostBoard_Type * HostBoard_current (void)
+{
+	return g_board;
+}
+
+/*
+ * Description :
+ * Return the average voltage fraction (0.0 .. 1.0) applied to the fan: the
+ * Timer0 fast PWM duty when the H-bridge pins drive the motor, zero otherwise.
+ */
+float64 HostBoard_getFanDuty (const HostBoard_Type * board)
+{
+	uint8 in1 = GET_BIT (board->portOutput[DC_PORT], DC_IN1_PIN);
+	uint8 in2 = GET_BIT (board->portOutput[DC_PORT], DC_IN2_PIN);
+
+	if ((!board->pwmRunning) || (in1 == in2) || (board->pwmDuty == 0))
+	{
+		return 0.0;
+	}
+	/* Non-inverting fast PWM keeps OC0 high for OCR0 + 1 of the 256 timer counts */
+	return ((float64)board->pwmDuty / (1 << PWM_TIMER0_FRACTION_BITS) + 1.0) / 256.0;
+}
+
+/*******************************************************************************
+ *                      ADC Driver Replacement                                 *
+ *******************************************************************************/
+void ADC_init(const ADC_ConfigType * Config_Ptr)
+{
+	(void)Config_Ptr;
+}
+
+uint16 ADC_readChannel (uint8 channelNum)
+{
+	g_board->adcConversions++;
+	return (g_board->adcRead != NULL_PTR) ? (g_board->adcRead (g_board->context, channelNum) & 0x03FF) : 0;
+}
+
+/* The modeled reference is exact, the readings need no correction */
+bool ADC_calibrate (void)
+{
+	return TRUE;
+}
+
+uint16 ADC_getCorrection (void)
+{
+	return ADC_CORRECTION_ONE;
+}
+
+void ADC_deinit (void)
+{
+}
+
+/*******************************************************************************
+ *                      PWM Timer0 Driver Replacement                          *
+ *******************************************************************************/
+void PWM_Timer0_start(uint8 duty_cycle)
+{
+	/* Same compare value equation as pwm_timer0.c */
+	PWM_Timer0_setDuty ((uint16)Fixed_scaleRound (duty_cycle, PWM_TIMER0_DUTY_MAX, 100));
+}
+
+void PWM_Timer0_setDuty(uint16 duty)
+{
+	if (duty > PWM_TIMER0_DUTY_MAX)
+	{
+		duty = PWM_TIMER0_DUTY_MAX;
+	}
+#if (PWM_TIMER0_DITHER == 0)
+	duty = ((duty + (1 << (PWM_TIMER0_FRACTION_BITS - 1))) >> PWM_TIMER0_FRACTION_BITS) << PWM_TIMER0_FRACTION_BITS;
+#endif
+	g_board->pwmDuty = duty;
+	g_board->ocr0 = (uint8)(duty >> PWM_TIMER0_FRACTION_BITS);
+	g_board->pwmRunning = TRUE;
+	g_board->pwmWrites++;
+}
+
+/*******************************************************************************
+ *                      System Tick Replacement                                *
+ *******************************************************************************/
+uint32 SysTick_getTicks (void)
+{
+	return g_board->ticks;
+}
+
+/*******************************************************************************
+ *                      GPIO Driver Replacement                                *
+ *******************************************************************************/
+void GPIO_setupPinDirection(uint8 port_num, uint8 pin_num, GPIO_PinDirectionType direction)
+{
+	if ((pin_num < NUM_OF_PINS_PER_PORT) && (port_num < NUM_OF_PORTS))
+	{
+		if (direction == PIN_OUTPUT)
+		{
+			SET_BIT (g_board->portDirection[port_num], pin_num);
+		}
+		else
+		{
+			CLEAR_BIT (g_board->portDirection[port_num], pin_num);
+		}
+	}
+}
+
+void GPIO_writePin(uint8 port_num, uint8 pin_num, uint8 value)
+{
+	if ((pin_num < NUM_OF_PINS_PER_PORT) && (port_num < NUM_OF_PORTS))
+	{
+		if (value == LOGIC_HIGH)
+		{
+			SET_BIT (g_board->portOutput[port_num], pin_num);
+		}
+		else
+		{
+			CLEAR_BIT (g_board->portOutput[port_num], pin_num);
+		}
+	}
+}
+
+uint8 GPIO_readPin(uint8 port_num, uint8 pin_num)
+{
+	if ((pin_num < NUM_OF_PINS_PER_PORT) && (port_num < NUM_OF_PORTS))
+	{
+		return GET_BIT (g_board->portInput[port_num], pin_num);
+	}
+	return LOGIC_LOW;
+}
+
+void GPIO_setupPortDirection(uint8 port_num, uint8 direction)
+{
+	if (port_num < NUM_OF_PORTS)
+	{
+		g_board->portDirection[port_num] = direction;
+	}
+}
+
+void GPIO_writePort(uint8 port_num, uint8 value)
+{
+	if (port_num < NUM_OF_PORTS)
+	{
+		g_board->portOutput[port_num] = value;
+	}
+}
+
+uint8 GPIO_readPort(uint8 port_num)
+{
+	return (port_num < NUM_OF_PORTS) ? g_board->portInput[port_num] : 0;
+}
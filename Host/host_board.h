@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ * Module: HOST_BOARD
+ *
+ * File Name: host_board.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the host replacement of the ATmega32 drivers
+ *              (ADC, PWM Timer0, GPIO and system tick) used to run the firmware
+ *              control code on Linux. Every thread binds its own board so several simulations
+ *              can run in parallel without sharing any state.
+ *
+ *******************************************************************************/
+
+#ifndef HOST_BOARD_H_
+#define HOST_BOARD_H_
+
+#include "std_types.h"
+#include "gpio.h"
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	/* Called for every ADC conversion, returns the 10-bit digital value of the channel */
+	uint16 (*adcRead)(void * context, uint8 channelNum);
+	void * context;
+
+	/* State of the emulated peripherals */
+	uint8 ocr0;
+	uint16 pwmDuty;                    /* Fine duty of the dithered PWM, OCR0 in 1/256 counts */
+	bool pwmRunning;
+	uint8 portOutput[NUM_OF_PORTS];
+	uint8 portDirection[NUM_OF_PORTS];
+	uint8 portInput[NUM_OF_PORTS];
+	uint32 ticks;                      /* System ticks, advanced by the simulation */
+
+	/* Access counters */
+	uint32 adcConversions;
+	uint32 pwmWrites;
+} HostBoard_Type;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Reset the peripherals of the board and bind it to the calling thread,
+ * all the driver calls of this thread are then served by this board.
+ */
+void HostBoard_bind (HostBoard_Type * board, uint16 (*adcRead)(void * context, uint8 channelNum), void * context);
+
+/*
+ * Description :
+ * Return the board bound to the calling thread.
+ */
+HostBoard_Type * HostBoard_current (void);
+
+/*
+ * Description :
+ * Return the average voltage fraction (0.0 .. 1.0) applied to the fan: the
+ * Timer0 fast PWM duty when the H-bridge pins drive the motor, zero otherwise.
+ * The dithered OCR0 is averaged over the PWM periods, much faster than the fan.
+ */
+float64 HostBoard_getFanDuty (const HostBoard_Type * board);
+
+#endif /* HOST_BOARD_H_ */
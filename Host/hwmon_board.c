@@ -0,0 +1,231 @@
+/******************************************************************************
+ *
+ * Module: HWMON_BOARD
+ *
+ * File Name: hwmon_board.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Linux hwmon backend of the host board. The firmware LM_35 module
+ *              reads the temperature attribute through the ADC of the host board
+ *              and the DC_MOTOR duty is written to the pwm attribute.
+ *
+ *******************************************************************************/
+
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+#include <linux/magic.h>
+#include "hwmon_board.h"
+#include "thermal_plant.h"
+#include "adc.h"
+#include "lm_35.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* Open <directory>/<name><index><suffix>, -1 with errno set on failure */
+static int HwmonBoard_openAttribute (const char * directory, const char * name, uint8 index, const char * suffix, int flags)
+{
+	char path[PATH_MAX];
+
+	if (snprintf (path, sizeof(path), "%s/%s%u%s", directory, name, index, suffix) >= (int)sizeof(path))
+	{
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+	return open (path, flags | O_CLOEXEC);
+}
+
+/* One integer from the start of the attribute, the kernel regenerates it on every read at offset zero */
+static bool HwmonBoard_readValue (int fd, sint32 * Value_Ptr)
+{
+	char text[32];
+	char * end;
+	ssize_t length = pread (fd, text, sizeof(text) - 1, 0);
+	long value;
+
+	if (length <= 0)
+	{
+		return FALSE;
+	}
+	text[length] = '\0';
+	errno = 0;
+	value = strtol (text, &end, 10);
+	if ((end == text) || (errno != 0))
+	{
+		return FALSE;
+	}
+	*Value_Ptr = (sint32)value;
+	return TRUE;
+}
+
+static bool HwmonBoard_writeValue (const HwmonBoard_Type * hwmon, int fd, sint32 value)
+{
+	char text[16];
+	int length = snprintf (text, sizeof(text), "%ld\n", (long)value);
+
+	if (pwrite (fd, text, length, 0) != length)
+	{
+		return FALSE;
+	}
+	/* A shorter value must not leave the tail of the previous one in a regular file */
+	if (hwmon->truncate && (ftruncate (fd, length) != 0))
+	{
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/* ADC of the host board: the LM35 voltage of the hwmon temperature on its channel */
+static uint16 HwmonBoard_adcRead (void * context, uint8 channelNum)
+{
+	HwmonBoard_Type * hwmon = (HwmonBoard_Type *)context;
+	sint32 milliCelsius;
+	float64 code;
+
+	if (channelNum != LM_35_SENSOR_CHANNEL)
+	{
+		return 0;
+	}
+	hwmon->tempReads++;
+	if (!HwmonBoard_readValue (hwmon->tempFd, &milliCelsius))
+	{
+		/* Same fail-safe as a sensor without a valid reading on the board: the fan runs at full speed */
+		hwmon->readErrors++;
+		return ADC_MAX_DIGITAL_VALUE;
+	}
+	hwmon->temperature = milliCelsius;
+	code = ThermalPlant_lm35Millivolts (milliCelsius / 1000.0) / (1000.0 * ADC_VOLTAGE_REFERENCE) * (ADC_MAX_DIGITAL_VALUE + 1);
+	return (code >= ADC_MAX_DIGITAL_VALUE) ? ADC_MAX_DIGITAL_VALUE : (uint16)code;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Open temp<tempIndex>_input and pwm<pwmIndex> of the hwmon directory, switch the
+ * pwm to manual mode through pwm<pwmIndex>_enable when it exists, then bind the board
+ * to the calling thread so the firmware drivers are served by these attributes.
+ * Returns FALSE with errno set if an attribute cannot be opened.
+ */
+bool HwmonBoard_open (HwmonBoard_Type * hwmon, const char * directory, uint8 tempIndex, uint8 pwmIndex)
+{
+	struct statfs fs;
+	int error;
+
+	hwmon->tempFd = HwmonBoard_openAttribute (directory, "temp", tempIndex, "_input", O_RDONLY);
+	hwmon->pwmFd = HwmonBoard_openAttribute (directory, "pwm", pwmIndex, "", O_RDWR);
+	hwmon->enableFd = HwmonBoard_openAttribute (directory, "pwm", pwmIndex, "_enable", O_RDWR);
+	hwmon->savedEnable = HWMON_NO_VALUE;
+	hwmon->writtenPwm = HWMON_NO_VALUE;
+	hwmon->temperature = 0;
+	hwmon->tempReads = 0;
+	hwmon->readErrors = 0;
+	hwmon->pwmWrites = 0;
+	hwmon->writeErrors = 0;
+
+	if ((hwmon->tempFd < 0) || (hwmon->pwmFd < 0))
+	{
+		error = errno;
+		HwmonBoard_close (hwmon);
+		errno = error;
+		return FALSE;
+	}
+
+	/* sysfs attributes keep their size, the files of a fake tree are cut to the written value */
+	hwmon->truncate = (fstatfs (hwmon->pwmFd, &fs) != 0) || (fs.f_type != SYSFS_MAGIC);
+
+	/* The chip keeps its automatic fan control until the pwm is switched to manual */
+	if ((hwmon->enableFd >= 0) && HwmonBoard_readValue (hwmon->enableFd, &hwmon->savedEnable)
+			&& (hwmon->savedEnable != HWMON_PWM_ENABLE_MANUAL))
+	{
+		if (!HwmonBoard_writeValue (hwmon, hwmon->enableFd, HWMON_PWM_ENABLE_MANUAL))
+		{
+			error = errno;
+			HwmonBoard_close (hwmon);
+			errno = error;
+			return FALSE;
+		}
+	}
+
+	HostBoard_bind (&hwmon->board, HwmonBoard_adcRead, hwmon);
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Write the fan duty set by the firmware to the pwm attribute, only when the
+ * value changed since the last write. Returns FALSE if the write failed.
+ */
+bool HwmonBoard_sync (HwmonBoard_Type * hwmon)
+{
+	sint32 pwm = (sint32)(HostBoard_getFanDuty (&hwmon->board) * HWMON_PWM_MAX + 0.5);
+
+	if (pwm == hwmon->writtenPwm)
+	{
+		return TRUE;
+	}
+	if (!HwmonBoard_writeValue (hwmon, hwmon->pwmFd, pwm))
+	{
+		hwmon->writeErrors++;
+		return FALSE;
+	}
+	hwmon->writtenPwm = pwm;
+	hwmon->pwmWrites++;
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Advance the system tick of the board by the given number of milliseconds.
+ */
+void HwmonBoard_advance (HwmonBoard_Type * hwmon, uint32 milliseconds)
+{
+	hwmon->board.ticks += SYS_TICK_MS_TO_TICKS (milliseconds);
+}
+
+/*
+ * Description :
+ * Restore the pwm mode found by the open, or leave the fan at full speed if the
+ * pwm was already manual, and close the attributes.
+ */
+void HwmonBoard_close (HwmonBoard_Type * hwmon)
+{
+	if ((hwmon->enableFd >= 0) && (hwmon->savedEnable != HWMON_NO_VALUE)
+			&& (hwmon->savedEnable != HWMON_PWM_ENABLE_MANUAL))
+	{
+		HwmonBoard_writeValue (hwmon, hwmon->enableFd, hwmon->savedEnable);
+	}
+	else if ((hwmon->pwmFd >= 0) && (hwmon->writtenPwm != HWMON_NO_VALUE))
+	{
+		/* Nothing controls the fan once the daemon is gone, leave it at full speed */
+		HwmonBoard_writeValue (hwmon, hwmon->pwmFd, HWMON_PWM_MAX);
+	}
+	if (hwmon->tempFd >= 0)
+	{
+		close (hwmon->tempFd);
+	}
+	if (hwmon->pwmFd >= 0)
+	{
+		close (hwmon->pwmFd);
+	}
+	if (hwmon->enableFd >= 0)
+	{
+		close (hwmon->enableFd);
+	}
+	hwmon->tempFd = -1;
+	hwmon->pwmFd = -1;
+	hwmon->enableFd = -1;
+}
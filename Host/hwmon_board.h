@@ -0,0 +1,85 @@
+/******************************************************************************
+ *
+ * Module: HWMON_BOARD
+ *
+ * File Name: hwmon_board.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the Linux hwmon backend of the host board: the
+ *              LM35 channel of the ADC reads a temp*_input attribute and the fan
+ *              duty is written to a pwm* attribute of a /sys/class/hwmon directory
+ *              (or of a fake tree with the same files). Every attribute is opened
+ *              once and accessed with pread / pwrite at offset zero.
+ *
+ *******************************************************************************/
+
+#ifndef HWMON_BOARD_H_
+#define HWMON_BOARD_H_
+
+#include "std_types.h"
+#include "host_board.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define HWMON_PWM_MAX                            255
+#define HWMON_PWM_ENABLE_MANUAL                  1
+#define HWMON_NO_VALUE                           (-1)
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	HostBoard_Type board;              /* Driver state of the firmware modules */
+
+	int tempFd;                        /* temp<N>_input, millidegrees Celsius */
+	int pwmFd;                         /* pwm<N>, 0 .. 255 */
+	int enableFd;                      /* pwm<N>_enable, -1 if the attribute does not exist */
+	bool truncate;                     /* Regular files of a fake tree, cut after every write */
+	sint32 savedEnable;                /* Mode restored by the close, HWMON_NO_VALUE if none */
+	sint32 writtenPwm;                 /* Last value written, HWMON_NO_VALUE before the first */
+
+	sint32 temperature;                /* Last valid reading in millidegrees */
+	uint32 tempReads;
+	uint32 readErrors;                 /* Failed readings, the fan is run at full speed */
+	uint32 pwmWrites;
+	uint32 writeErrors;
+} HwmonBoard_Type;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Open temp<tempIndex>_input and pwm<pwmIndex> of the hwmon directory, switch the
+ * pwm to manual mode through pwm<pwmIndex>_enable when it exists, then bind the board
+ * to the calling thread so the firmware drivers are served by these attributes.
+ * Returns FALSE with errno set if an attribute cannot be opened.
+ */
+bool HwmonBoard_open (HwmonBoard_Type * hwmon, const char * directory, uint8 tempIndex, uint8 pwmIndex);
+
+/*
+ * Description :
+ * Write the fan duty set by the firmware to the pwm attribute, only when the
+ * value changed since the last write. Returns FALSE if the write failed.
+ */
+bool HwmonBoard_sync (HwmonBoard_Type * hwmon);
+
+/*
+ * Description :
+ * Advance the system tick of the board by the given number of milliseconds.
+ */
+void HwmonBoard_advance (HwmonBoard_Type * hwmon, uint32 milliseconds);
+
+/*
+ * Description :
+ * Restore the pwm mode found by the open, or leave the fan at full speed if the
+ * pwm was already manual, and close the attributes.
+ */
+void HwmonBoard_close (HwmonBoard_Type * hwmon);
+
+#endif /* HWMON_BOARD_H_ */
@@ -0,0 +1,232 @@
+/******************************************************************************
+ *
+ * Module: MODBUS_MASTER
+ *
+ * File Name: modbus_master.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Minimal Modbus RTU master for a serial port or the pseudo-terminal
+ *              of modbus_slave: sends one request, checks the response CRC and
+ *              prints the registers and the response time. The framing and the CRC
+ *              are implemented here again, independently of the firmware MODBUS module.
+ *
+ * Usage: modbus_master -d DEVICE [options] COMMAND
+ *        -a ADDR   slave address (default 1)
+ *        -b BAUD   baud rate of a real serial port, 8E1 (default 9600)
+ *        -t MS     response timeout (default 100)
+ *        COMMAND   holding START COUNT | input START COUNT | write START VALUE [VALUE...]
+ *
+ *******************************************************************************/
+
+#define _DEFAULT_SOURCE
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "modbus.h"
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void ModbusMaster_usage (const char * program)
+{
+	fprintf (stderr, "usage: %s -d device [-a addr] [-b baud] [-t timeout_ms] holding|input START COUNT\n"
+			"       %s -d device [-a addr] [-b baud] [-t timeout_ms] write START VALUE [VALUE...]\n", program, program);
+}
+
+static float64 ModbusMaster_now (void)
+{
+	struct timespec now;
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static speed_t ModbusMaster_speed (unsigned long baud)
+{
+	switch (baud)
+	{
+	case 1200: return B1200;
+	case 2400: return B2400;
+	case 4800: return B4800;
+	case 19200: return B19200;
+	case 38400: return B38400;
+	case 57600: return B57600;
+	case 115200: return B115200;
+	default: return B9600;
+	}
+}
+
+static uint16 ModbusMaster_crc16 (const uint8 * Data_Ptr, int length)
+{
+	uint16 crc = MODBUS_CRC_INIT;
+	int i;
+	int bit;
+
+	for (i = 0; i < length; i++)
+	{
+		crc ^= Data_Ptr[i];
+		for (bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 1) ? (uint16)((crc >> 1) ^ 0xA001) : (uint16)(crc >> 1);
+		}
+	}
+	return crc;
+}
+
+static void ModbusMaster_putWord (uint8 * Frame_Ptr, uint8 index, unsigned long value)
+{
+	Frame_Ptr[index] = (uint8)(value >> 8);
+	Frame_Ptr[index + 1] = (uint8)value;
+}
+
+/* Receive until 3.5 characters of silence after the first byte or the response timeout */
+static int ModbusMaster_receive (int fd, uint8 * Frame_Ptr, int timeoutMs, int silenceMs)
+{
+	struct pollfd fds = {fd, POLLIN, 0};
+	int length = 0;
+
+	while (poll (&fds, 1, (length == 0) ? timeoutMs : silenceMs) > 0)
+	{
+		if ((length >= MODBUS_FRAME_SIZE) || (read (fd, &Frame_Ptr[length], 1) != 1))
+		{
+			return -1;
+		}
+		length++;
+	}
+	return length;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (int argc, char * argv[])
+{
+	uint8 frame[MODBUS_FRAME_SIZE];
+	const char * device = NULL_PTR;
+	unsigned long address = MODBUS_SLAVE_ADDRESS;
+	unsigned long baud = 9600;
+	int timeoutMs = 100;
+	int silenceMs;
+	struct termios tty;
+	uint8 length;
+	int received;
+	float64 start;
+	int count;
+	int fd;
+	int opt;
+	int i;
+
+	while ((opt = getopt (argc, argv, "d:a:b:t:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'd': device = optarg; break;
+		case 'a': address = strtoul (optarg, NULL_PTR, 0); break;
+		case 'b': baud = strtoul (optarg, NULL_PTR, 0); break;
+		case 't': timeoutMs = atoi (optarg); break;
+		default:
+			ModbusMaster_usage (argv[0]);
+			return 2;
+		}
+	}
+	if ((device == NULL_PTR) || (argc - optind < 3) || (baud == 0))
+	{
+		ModbusMaster_usage (argv[0]);
+		return 2;
+	}
+	silenceMs = (baud > 19200) ? 2 : (int)((35UL * 11UL * 1000UL + 10UL * baud - 1) / (10UL * baud));
+
+	/* Build the request */
+	frame[0] = (uint8)address;
+	count = argc - optind - 2;
+	ModbusMaster_putWord (frame, 2, strtoul (argv[optind + 1], NULL_PTR, 0));
+	if ((strcmp (argv[optind], "holding") == 0) || (strcmp (argv[optind], "input") == 0))
+	{
+		frame[1] = (argv[optind][0] == 'h') ? MODBUS_READ_HOLDING_REGISTERS : MODBUS_READ_INPUT_REGISTERS;
+		ModbusMaster_putWord (frame, 4, strtoul (argv[optind + 2], NULL_PTR, 0));
+		length = 6;
+	}
+	else if ((strcmp (argv[optind], "write") == 0) && (count == 1))
+	{
+		frame[1] = MODBUS_WRITE_SINGLE_REGISTER;
+		ModbusMaster_putWord (frame, 4, strtoul (argv[optind + 2], NULL_PTR, 0));
+		length = 6;
+	}
+	else if ((strcmp (argv[optind], "write") == 0) && (count <= MODBUS_MAX_REGISTERS))
+	{
+		frame[1] = MODBUS_WRITE_MULTIPLE_REGISTERS;
+		ModbusMaster_putWord (frame, 4, (unsigned long)count);
+		frame[6] = (uint8)(2 * count);
+		for (i = 0; i < count; i++)
+		{
+			ModbusMaster_putWord (frame, (uint8)(7 + 2 * i), strtoul (argv[optind + 2 + i], NULL_PTR, 0));
+		}
+		length = (uint8)(7 + 2 * count);
+	}
+	else
+	{
+		ModbusMaster_usage (argv[0]);
+		return 2;
+	}
+	ModbusMaster_putWord (frame, length, ModbusMaster_crc16 (frame, length));
+	frame[length + 1] = frame[length];          /* The CRC is sent low byte first */
+	frame[length] = (uint8)ModbusMaster_crc16 (frame, length);
+	length += MODBUS_CRC_SIZE;
+
+	fd = open (device, O_RDWR | O_NOCTTY);
+	if ((fd < 0) || (tcgetattr (fd, &tty) != 0))
+	{
+		perror (device);
+		return 1;
+	}
+	cfmakeraw (&tty);
+	tty.c_cflag |= PARENB;                     /* 8E1, the RTU default frame */
+	tty.c_cflag &= ~(PARODD | CSTOPB);
+	cfsetspeed (&tty, ModbusMaster_speed (baud));
+	tcsetattr (fd, TCSANOW, &tty);
+	tcflush (fd, TCIOFLUSH);
+
+	start = ModbusMaster_now ();
+	if (write (fd, frame, length) != length)
+	{
+		perror ("write");
+		return 1;
+	}
+	tcdrain (fd);
+	received = ModbusMaster_receive (fd, frame, timeoutMs, silenceMs);
+	if (received <= 0)
+	{
+		fprintf (stderr, "no response within %d ms\n", timeoutMs);
+		return 1;
+	}
+	printf ("response of %d bytes after %.2f ms\n", received, (ModbusMaster_now () - start) * 1e3);
+	if ((received < 5) || (ModbusMaster_crc16 (frame, received) != 0))
+	{
+		fprintf (stderr, "bad response CRC\n");
+		return 1;
+	}
+	if (frame[1] & MODBUS_EXCEPTION_FLAG)
+	{
+		fprintf (stderr, "exception 0x%02X\n", frame[2]);
+		return 1;
+	}
+
+	if ((frame[1] == MODBUS_READ_HOLDING_REGISTERS) || (frame[1] == MODBUS_READ_INPUT_REGISTERS))
+	{
+		unsigned long first = strtoul (argv[optind + 1], NULL_PTR, 0);
+		for (i = 0; i < frame[2] / 2; i++)
+		{
+			uint16 value = (uint16)((frame[3 + 2 * i] << 8) | frame[4 + 2 * i]);
+			printf ("%lu: %u (0x%04X)\n", first + i, value, value);
+		}
+	}
+	close (fd);
+	return 0;
+}
@@ -0,0 +1,370 @@
+/******************************************************************************
+ *
+ * Module: MODBUS_SLAVE
+ *
+ * File Name: modbus_slave.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Modbus RTU slave on a Linux pseudo-terminal. The firmware MODBUS
+ *              module executes the requests against a simulated register map with
+ *              the layout of modbus_cfg.h, the frames end after 3.5 characters of
+ *              silence as on the target, and the response latency of every
+ *              request is printed.
+ *
+ * Usage: modbus_slave [options]
+ *        -b BAUD   baud rate used for the 3.5 characters silence (default 9600)
+ *        -l PATH   symbolic link created to the pseudo-terminal (e.g. /tmp/fan_modbus)
+ *        -n N      exit after N requests (default: run until killed)
+ *
+ *******************************************************************************/
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "modbus.h"
+#include "modbus_cfg.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Simulated controller state, the temperature follows the setpoint written by the master */
+static uint16 g_minSpeed = 0;
+static uint16 g_setpoint = 55;
+static uint16 g_autotune = 0;
+static uint16 g_lastLatency = 0;
+static uint16 g_maxLatency = 0;
+static uint16 g_lateResponses = 0;
+static uint16 g_droppedFrames = 0;
+static uint16 g_pwmSync = 1;
+static uint16 g_feedForwardEnable = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static uint16 ModbusSlave_readTemperature (void)
+{
+	return (uint16)((sint16)(g_setpoint + 2) << 8);
+}
+
+static uint16 ModbusSlave_readStatus (void)
+{
+	return 1;
+}
+
+static uint16 ModbusSlave_readSpeed (void)
+{
+	return (g_minSpeed > 50) ? g_minSpeed : 50;
+}
+
+static uint16 ModbusSlave_readRpm (void)
+{
+	return MODBUS_NOT_MEASURED;
+}
+
+static uint16 ModbusSlave_readFeedForward (void)
+{
+	return 0;
+}
+
+static uint16 ModbusSlave_readLoopPeriod (void)
+{
+	return 0;
+}
+
+static uint16 ModbusSlave_readLastLatency (void)
+{
+	return g_lastLatency;
+}
+
+static uint16 ModbusSlave_readMaxLatency (void)
+{
+	return g_maxLatency;
+}
+
+static uint16 ModbusSlave_readLateResponses (void)
+{
+	return g_lateResponses;
+}
+
+static uint16 ModbusSlave_readDroppedFrames (void)
+{
+	return g_droppedFrames;
+}
+
+static uint16 ModbusSlave_readNoise (void)
+{
+	/* Placeholder deviations in Q8.8 codes, the real ones are measured on the board */
+	return g_pwmSync ? 0x0040 : 0x0100;
+}
+
+static uint16 ModbusSlave_readBootTime (void)
+{
+	return 0;
+}
+
+static uint16 ModbusSlave_readAdcDuty (void)
+{
+	return 0;
+}
+
+static uint16 ModbusSlave_readSampledShare (void)
+{
+	return 100;
+}
+
+static uint16 ModbusSlave_readResetRecord (void)
+{
+	return 0;
+}
+
+static uint16 ModbusSlave_readResetPeriod (void)
+{
+	return 0;
+}
+
+static uint16 ModbusSlave_readMinSpeed (void)
+{
+	return g_minSpeed;
+}
+
+static void ModbusSlave_writeMinSpeed (uint16 value)
+{
+	g_minSpeed = value;
+}
+
+static uint16 ModbusSlave_readSetpoint (void)
+{
+	return g_setpoint;
+}
+
+static void ModbusSlave_writeSetpoint (uint16 value)
+{
+	g_setpoint = value;
+}
+
+static uint16 ModbusSlave_readAutotune (void)
+{
+	return g_autotune;
+}
+
+static void ModbusSlave_writeAutotune (uint16 value)
+{
+	g_autotune = value;
+}
+
+static uint16 ModbusSlave_readPwmSync (void)
+{
+	return g_pwmSync;
+}
+
+static void ModbusSlave_writePwmSync (uint16 value)
+{
+	g_pwmSync = value;
+}
+
+static uint16 ModbusSlave_readFeedForwardEnable (void)
+{
+	return g_feedForwardEnable;
+}
+
+static void ModbusSlave_writeFeedForwardEnable (uint16 value)
+{
+	g_feedForwardEnable = value;
+}
+
+static float64 ModbusSlave_now (void)
+{
+	struct timespec now;
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Same addresses, ranges and write rules as modbus_cfg.c */
+const Modbus_RegisterType g_modbusInputRegisters[MODBUS_NUM_OF_INPUT_REGISTERS] = {
+	{ModbusSlave_readTemperature, NULL_PTR, 0, 0},
+	{ModbusSlave_readStatus, NULL_PTR, 0, 0},
+	{ModbusSlave_readSpeed, NULL_PTR, 0, 0},
+	{ModbusSlave_readRpm, NULL_PTR, 0, 0},
+	{ModbusSlave_readFeedForward, NULL_PTR, 0, 0},
+	{ModbusSlave_readLoopPeriod, NULL_PTR, 0, 0},
+	{ModbusSlave_readLastLatency, NULL_PTR, 0, 0},
+	{ModbusSlave_readMaxLatency, NULL_PTR, 0, 0},
+	{ModbusSlave_readLateResponses, NULL_PTR, 0, 0},
+	{ModbusSlave_readDroppedFrames, NULL_PTR, 0, 0},
+	{ModbusSlave_readNoise, NULL_PTR, 0, 0},
+	{ModbusSlave_readBootTime, NULL_PTR, 0, 0},
+	{ModbusSlave_readAdcDuty, NULL_PTR, 0, 0},
+	{ModbusSlave_readSampledShare, NULL_PTR, 0, 0},
+	{ModbusSlave_readResetRecord, NULL_PTR, 0, 0},
+	{ModbusSlave_readResetPeriod, NULL_PTR, 0, 0}
+};
+
+const Modbus_RegisterType g_modbusHoldingRegisters[MODBUS_NUM_OF_HOLDING_REGISTERS] = {
+	{ModbusSlave_readMinSpeed, ModbusSlave_writeMinSpeed, 0, 100},
+	{ModbusSlave_readSetpoint, ModbusSlave_writeSetpoint, 20, 100},
+	{ModbusSlave_readAutotune, ModbusSlave_writeAutotune, 0, MODBUS_AUTOTUNE_MAX},
+	{ModbusSlave_readPwmSync, ModbusSlave_writePwmSync, 0, 1},
+	{ModbusSlave_readFeedForwardEnable, ModbusSlave_writeFeedForwardEnable, 0, 1}
+};
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (int argc, char * argv[])
+{
+	uint8 frame[MODBUS_FRAME_SIZE];
+	uint8 length = 0;
+	bool overflow = FALSE;
+	uint32 baud = 9600;
+	long remaining = -1;
+	const char * linkPath = NULL_PTR;
+	struct termios raw;
+	struct pollfd fds;
+	float64 lastByte = 0.0;
+	int silenceMs;
+	int master;
+	int slave;
+	int opt;
+
+	while ((opt = getopt (argc, argv, "b:l:n:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'b': baud = (uint32)strtoul (optarg, NULL_PTR, 0); break;
+		case 'l': linkPath = optarg; break;
+		case 'n': remaining = strtol (optarg, NULL_PTR, 0); break;
+		default:
+			fprintf (stderr, "usage: %s [-b baud] [-l link_path] [-n requests]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (baud == 0)
+	{
+		return 2;
+	}
+
+	/* 3.5 characters of 11 bits, 1.75 ms above 19200 baud, rounded up to the poll resolution */
+	silenceMs = (baud > 19200) ? 2 : (int)((35UL * 11UL * 1000UL + 10UL * baud - 1) / (10UL * baud));
+
+	master = posix_openpt (O_RDWR | O_NOCTTY);
+	if ((master < 0) || (grantpt (master) != 0) || (unlockpt (master) != 0))
+	{
+		perror ("pseudo-terminal");
+		return 1;
+	}
+
+	/* Keep the terminal side open in raw mode so the bytes are passed through untouched */
+	slave = open (ptsname (master), O_RDWR | O_NOCTTY);
+	if ((slave < 0) || (tcgetattr (slave, &raw) != 0))
+	{
+		perror (ptsname (master));
+		return 1;
+	}
+	cfmakeraw (&raw);
+	tcsetattr (slave, TCSANOW, &raw);
+
+	if (linkPath != NULL_PTR)
+	{
+		unlink (linkPath);
+		if (symlink (ptsname (master), linkPath) != 0)
+		{
+			perror (linkPath);
+			return 1;
+		}
+	}
+	printf ("modbus slave %d on %s, %lu baud, 3.5 characters = %d ms\n", MODBUS_SLAVE_ADDRESS,
+			(linkPath != NULL_PTR) ? linkPath : ptsname (master), (unsigned long)baud, silenceMs);
+	fflush (stdout);
+
+	fds.fd = master;
+	fds.events = POLLIN;
+	while (remaining != 0)
+	{
+		int ready = poll (&fds, 1, (length > 0 || overflow) ? silenceMs : -1);
+		uint8 response;
+		float64 latency;
+
+		if (ready < 0)
+		{
+			perror ("poll");
+			return 1;
+		}
+		if (ready > 0)
+		{
+			uint8 byte;
+			if (read (master, &byte, 1) == 1)
+			{
+				if (length < MODBUS_FRAME_SIZE)
+				{
+					frame[length++] = byte;
+				}
+				else
+				{
+					overflow = TRUE;
+				}
+				lastByte = ModbusSlave_now ();
+			}
+			continue;
+		}
+
+		/* Silence: the frame is complete */
+		if (overflow || (length < 2 + MODBUS_CRC_SIZE) || (Modbus_crc16 (frame, length) != 0))
+		{
+			g_droppedFrames++;
+			printf ("dropped frame of %u bytes\n", length);
+			length = 0;
+			overflow = FALSE;
+			continue;
+		}
+		response = Modbus_handleFrame (frame, (uint8)(length - MODBUS_CRC_SIZE));
+		if (response != 0)
+		{
+			response = Modbus_appendCrc (frame, response);
+			latency = ModbusSlave_now () - lastByte;
+			if (write (master, frame, response) != response)
+			{
+				perror ("write");
+				return 1;
+			}
+			g_lastLatency = (latency * 1e6 > 65535.0) ? 65535 : (uint16)(latency * 1e6);
+			g_maxLatency = (g_lastLatency > g_maxLatency) ? g_lastLatency : g_maxLatency;
+			if (latency > 0.1)
+			{
+				g_lateResponses++;             /* Later than the 100 ms response timeout of the target */
+			}
+			printf ("function 0x%02X: %u byte response after %.2f ms%s\n", frame[1], response, latency * 1e3,
+					(frame[1] & MODBUS_EXCEPTION_FLAG) ? " (exception)" : "");
+		}
+		fflush (stdout);
+		length = 0;
+		if (remaining > 0)
+		{
+			remaining--;
+		}
+	}
+
+	/* Closing the pseudo-terminal drops the bytes not read yet, leave time to read the last response */
+	usleep (200000);
+	if (linkPath != NULL_PTR)
+	{
+		unlink (linkPath);
+	}
+	close (slave);
+	close (master);
+	return 0;
+}
@@ -0,0 +1,250 @@
+/******************************************************************************
+ *
+ * Module: RING_BUFFER_STRESS
+ *
+ * File Name: ring_buffer_stress.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Two-thread stress test of the firmware RING_BUFFER module. A
+ *              producer thread pushes a running byte sequence with single and
+ *              bulk pushes while a consumer thread pops it with single and bulk
+ *              pops, for every ring size. The consumer checks every byte against
+ *              the sequence and the count against the size, so a reordered,
+ *              lost, duplicated or torn byte fails the run, and the free running
+ *              8-bit indexes wrap around many times.
+ *
+ * Usage: ring_buffer_stress [options]
+ *        -n N      bytes pushed through each ring size (default 4000000)
+ *        -r SEED   seed of the operation mix (default 1)
+ *
+ *******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "ring_buffer.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define STRESS_MAX_BLOCK                         9          /* Longest bulk push / pop */
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	RingBuffer_Type ring;
+	uint8 size;
+	uint32 total;                      /* Bytes to push */
+	uint32 seed;
+
+	/* Results, each written by its own thread */
+	uint32 rejected;                   /* Pushes refused by the producer side */
+	uint32 received;
+	uint32 errors;
+	uint32 firstErrorAt;
+	uint8 maxCount;
+} Stress_Type;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static uint32 Stress_random (uint32 * state)
+{
+	/* xorshift32, enough to vary the operation mix */
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+static void * Stress_producer (void * argument)
+{
+	Stress_Type * stress = (Stress_Type *)argument;
+	uint32 state = stress->seed;
+	uint32 sent = 0;
+	uint8 block[STRESS_MAX_BLOCK];
+	uint8 length;
+	uint8 i;
+
+	while (sent < stress->total)
+	{
+		if (Stress_random (&state) & 1)
+		{
+			if (RingBuffer_push (&stress->ring, (uint8)sent))
+			{
+				sent++;
+			}
+			else
+			{
+				stress->rejected++;
+				sched_yield ();
+			}
+			continue;
+		}
+
+		/* A block longer than the ring is always refused, which is checked too */
+		length = (uint8)(1 + Stress_random (&state) % STRESS_MAX_BLOCK);
+		if (length > stress->total - sent)
+		{
+			length = (uint8)(stress->total - sent);
+		}
+		for (i = 0; i < length; i++)
+		{
+			block[i] = (uint8)(sent + i);
+		}
+		if (RingBuffer_pushBulk (&stress->ring, block, length))
+		{
+			sent += length;
+		}
+		else
+		{
+			stress->rejected++;
+			sched_yield ();
+		}
+	}
+	return NULL_PTR;
+}
+
+static void Stress_check (Stress_Type * stress, uint8 byte)
+{
+	if (byte != (uint8)stress->received)
+	{
+		if (stress->errors == 0)
+		{
+			stress->firstErrorAt = stress->received;
+		}
+		stress->errors++;
+	}
+	stress->received++;
+}
+
+static void * Stress_consumer (void * argument)
+{
+	Stress_Type * stress = (Stress_Type *)argument;
+	uint32 state = stress->seed * 7919 + 1;
+	uint8 block[STRESS_MAX_BLOCK];
+	uint8 count;
+	uint8 byte;
+	uint8 i;
+
+	while (stress->received < stress->total)
+	{
+		count = RingBuffer_getCount (&stress->ring);
+		if (count > stress->maxCount)
+		{
+			stress->maxCount = count;
+		}
+
+		if (Stress_random (&state) & 1)
+		{
+			if (RingBuffer_pop (&stress->ring, &byte))
+			{
+				Stress_check (stress, byte);
+			}
+			else
+			{
+				sched_yield ();
+			}
+			continue;
+		}
+		count = RingBuffer_popBulk (&stress->ring, block, (uint8)(1 + Stress_random (&state) % STRESS_MAX_BLOCK));
+		for (i = 0; i < count; i++)
+		{
+			Stress_check (stress, block[i]);
+		}
+		if (count == 0)
+		{
+			sched_yield ();
+		}
+	}
+	return NULL_PTR;
+}
+
+static bool Stress_run (uint8 size, uint32 total, uint32 seed)
+{
+	static uint8 storage[RING_BUFFER_MAX_SIZE];
+	Stress_Type stress = {0};
+	pthread_t producer;
+	pthread_t consumer;
+	bool ok;
+
+	stress.size = size;
+	stress.total = total;
+	stress.seed = seed;
+	if (!RingBuffer_init (&stress.ring, storage, size))
+	{
+		printf ("size %3u: init failed\n", size);
+		return FALSE;
+	}
+	if ((pthread_create (&consumer, NULL_PTR, Stress_consumer, &stress) != 0)
+			|| (pthread_create (&producer, NULL_PTR, Stress_producer, &stress) != 0))
+	{
+		perror ("pthread_create");
+		return FALSE;
+	}
+	pthread_join (producer, NULL_PTR);
+	pthread_join (consumer, NULL_PTR);
+
+	ok = (stress.errors == 0) && (stress.received == total) && (stress.maxCount <= size)
+			&& (RingBuffer_getCount (&stress.ring) == 0) && (RingBuffer_getOverflows (&stress.ring) == (uint16)stress.rejected);
+	printf ("size %3u: %lu bytes, %lu index wraps, %lu rejected pushes, max count %u, %lu errors%s\n", size,
+			(unsigned long)stress.received, (unsigned long)(total / 256), (unsigned long)stress.rejected,
+			stress.maxCount, (unsigned long)stress.errors, ok ? "" : "  FAILED");
+	if (stress.errors != 0)
+	{
+		printf ("          first wrong byte at %lu\n", (unsigned long)stress.firstErrorAt);
+	}
+	return ok;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (int argc, char * argv[])
+{
+	static const uint8 sizes[] = {2, 4, 16, 64, RING_BUFFER_MAX_SIZE};
+	uint32 total = 4000000;
+	uint32 seed = 1;
+	bool ok = TRUE;
+	uint8 storage[4];
+	RingBuffer_Type ring;
+	uint8 i;
+	int opt;
+
+	while ((opt = getopt (argc, argv, "n:r:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'n': total = (uint32)strtoul (optarg, NULL_PTR, 0); break;
+		case 'r': seed = (uint32)strtoul (optarg, NULL_PTR, 0); break;
+		default:
+			fprintf (stderr, "usage: %s [-n bytes] [-r seed]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (seed == 0)
+	{
+		seed = 1;                      /* xorshift stays at zero */
+	}
+
+	/* The sizes the ring must refuse */
+	if (RingBuffer_init (&ring, storage, 0) || RingBuffer_init (&ring, storage, 3)
+			|| RingBuffer_init (&ring, storage, RING_BUFFER_MAX_SIZE * 2 - 1) || RingBuffer_init (&ring, NULL_PTR, 4))
+	{
+		printf ("invalid ring accepted  FAILED\n");
+		ok = FALSE;
+	}
+
+	for (i = 0; i < sizeof(sizes); i++)
+	{
+		ok &= Stress_run (sizes[i], total, seed + i);
+	}
+	printf ("%s\n", ok ? "ring buffer stress passed" : "ring buffer stress FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+/******************************************************************************
+ *
+ * Module: THERMAL_PLANT
+ *
+ * File Name: thermal_plant.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the lumped thermal model of the fan enclosure
+ *              and for the heat load scenarios driving it.
+ *
+ *******************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "thermal_plant.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Default enclosure: 125 C without the fan and 45 C at full speed under a 40 W load */
+#define THERMAL_DEFAULT_MASS                     400.0
+#define THERMAL_DEFAULT_PASSIVE_CONDUCTANCE      0.4
+#define THERMAL_DEFAULT_FAN_CONDUCTANCE          1.6
+#define THERMAL_DEFAULT_FAN_POWER                6.0
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Fill the plant with the default enclosure parameters at the given temperature.
+ */
+void ThermalPlant_init (ThermalPlant_Type * plant, float64 temperature)
+{
+	plant->thermalMass = THERMAL_DEFAULT_MASS;
+	plant->passiveConductance = THERMAL_DEFAULT_PASSIVE_CONDUCTANCE;
+	plant->fanConductance = THERMAL_DEFAULT_FAN_CONDUCTANCE;
+	plant->fanMaxPower = THERMAL_DEFAULT_FAN_POWER;
+	plant->temperature = temperature;
+}
+
+/*
+ * Description :
+ * Advance the plant by dt seconds with a constant heat load, ambient and fan duty (0.0 .. 1.0).
+ * The first order equation is solved exactly over the step so large steps stay stable.
+ */
+void ThermalPlant_step (ThermalPlant_Type * plant, const ThermalSegment_Type * load, float64 duty, float64 dt)
+{
+	float64 conductance = plant->passiveConductance + (plant->fanConductance * duty);
+	float64 steadyState = load->ambient + (load->heatPower / conductance);
+
+	plant->temperature = steadyState + ((plant->temperature - steadyState) * exp (-conductance * dt / plant->thermalMass));
+}
+
+/*
+ * Description :
+ * Return the fan electrical power in W at the given duty (0.0 .. 1.0).
+ */
+float64 ThermalPlant_fanPower (const ThermalPlant_Type * plant, float64 duty)
+{
+	return plant->fanMaxPower * duty * duty * duty;
+}
+
+/*
+ * Description :
+ * Return the LM35 output voltage in mV for the given temperature, clamped to the sensor range.
+ */
+float64 ThermalPlant_lm35Millivolts (float64 temperature)
+{
+	float64 millivolts = temperature * THERMAL_LM35_MV_PER_DEGREE;
+
+	if (millivolts < 0.0)
+	{
+		return 0.0;
+	}
+	return (millivolts > THERMAL_LM35_MAX_MV) ? THERMAL_LM35_MAX_MV : millivolts;
+}
+
+/*
+ * Description :
+ * Build one of the synthetic scenarios: "step", "pulse" or "ramp".
+ * Returns FALSE if the name is unknown.
+ */
+bool ThermalScenario_synthetic (ThermalScenario_Type * scenario, const char * name, float64 heatPower,
+		float64 ambient, float64 duration)
+{
+	uint16 i;
+
+	memset (scenario, 0, sizeof(*scenario));
+	snprintf (scenario->name, sizeof(scenario->name), "%s", name);
+	scenario->duration = duration;
+
+	if (strcmp (name, "step") == 0)
+	{
+		/* Constant full load from a cold start */
+		scenario->segments[0] = (ThermalSegment_Type){0.0, heatPower, ambient};
+		scenario->numOfSegments = 1;
+	}
+	else if (strcmp (name, "pulse") == 0)
+	{
+		/* Load toggling between full and a quarter every 20 minutes */
+		for (i = 0; (i < THERMAL_SCENARIO_MAX_SEGMENTS) && (i * 1200.0 < duration); i++)
+		{
+			scenario->segments[i] = (ThermalSegment_Type){i * 1200.0, (i % 2 == 0) ? heatPower : heatPower / 4, ambient};
+		}
+		scenario->numOfSegments = i;
+	}
+	else if (strcmp (name, "ramp") == 0)
+	{
+		/* Load rising in ten equal steps over the first half of the run */
+		for (i = 0; i < 10; i++)
+		{
+			scenario->segments[i] = (ThermalSegment_Type){i * duration / 20, heatPower * (i + 1) / 10, ambient};
+		}
+		scenario->numOfSegments = 10;
+	}
+	else
+	{
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Load a recorded scenario from a text file with one "time_s heat_W ambient_C"
+ * segment per line ('#' starts a comment). Returns FALSE on error.
+ */
+bool ThermalScenario_load (ThermalScenario_Type * scenario, const char * path, float64 duration)
+{
+	FILE * file = fopen (path, "r");
+	char line[128];
+	ThermalSegment_Type segment;
+	const char * baseName = strrchr (path, '/');
+
+	if (file == NULL)
+	{
+		perror (path);
+		return FALSE;
+	}
+	memset (scenario, 0, sizeof(*scenario));
+	snprintf (scenario->name, sizeof(scenario->name), "%s", (baseName != NULL) ? baseName + 1 : path);
+
+	while (fgets (line, sizeof(line), file) != NULL)
+	{
+		if ((line[0] == '#') || (sscanf (line, "%lf %lf %lf", &segment.startTime, &segment.heatPower, &segment.ambient) != 3))
+		{
+			continue;
+		}
+		if ((scenario->numOfSegments == THERMAL_SCENARIO_MAX_SEGMENTS) ||
+				((scenario->numOfSegments > 0) && (segment.startTime <= scenario->segments[scenario->numOfSegments - 1].startTime)))
+		{
+			fprintf (stderr, "%s: too many segments or times not increasing\n", path);
+			fclose (file);
+			return FALSE;
+		}
+		scenario->segments[scenario->numOfSegments++] = segment;
+	}
+	fclose (file);
+
+	if (scenario->numOfSegments == 0)
+	{
+		fprintf (stderr, "%s: no segments\n", path);
+		return FALSE;
+	}
+	/* Without an explicit duration the recording is replayed one hour past its last change */
+	scenario->duration = (duration > 0.0) ? duration : scenario->segments[scenario->numOfSegments - 1].startTime + 3600.0;
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Return the segment active at the given time, the index is a search hint
+ * updated in place so sequential lookups are O(1).
+ */
+const ThermalSegment_Type * ThermalScenario_at (const ThermalScenario_Type * scenario, float64 time, uint16 * index)
+{
+	while ((*index + 1 < scenario->numOfSegments) && (scenario->segments[*index + 1].startTime <= time))
+	{
+		(*index)++;
+	}
+	return &scenario->segments[*index];
+}
@@ -0,0 +1,112 @@
+/******************************************************************************
+ *
+ * Module: THERMAL_PLANT
+ *
+ * File Name: thermal_plant.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the lumped thermal model of the fan enclosure
+ *              and for the heat load scenarios driving it.
+ *
+ *******************************************************************************/
+
+#ifndef THERMAL_PLANT_H_
+#define THERMAL_PLANT_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Parameters Definitions */
+#define THERMAL_SCENARIO_MAX_SEGMENTS            256
+#define THERMAL_LM35_MV_PER_DEGREE               10.0
+#define THERMAL_LM35_MAX_MV                      1500.0
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/*
+ * One heat source with a thermal mass, cooled by natural convection to the
+ * ambient air and by the fan, whose conductance grows with the fan speed:
+ *   C dT/dt = P - (G0 + Gf * duty) * (T - Tamb)
+ * The fan electrical power follows the fan affinity law P = Pmax * duty^3.
+ */
+typedef struct{
+	float64 thermalMass;               /* C in J/C */
+	float64 passiveConductance;        /* G0 in W/C */
+	float64 fanConductance;            /* Gf in W/C at full duty */
+	float64 fanMaxPower;               /* Pmax in W */
+	float64 temperature;               /* T in C */
+} ThermalPlant_Type;
+
+/* The heat load and the ambient temperature are constant from startTime until the next segment */
+typedef struct{
+	float64 startTime;                 /* s */
+	float64 heatPower;                 /* W */
+	float64 ambient;                   /* C */
+} ThermalSegment_Type;
+
+typedef struct{
+	char name[32];
+	uint16 numOfSegments;
+	float64 duration;                  /* s */
+	ThermalSegment_Type segments[THERMAL_SCENARIO_MAX_SEGMENTS];
+} ThermalScenario_Type;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Fill the plant with the default enclosure parameters at the given temperature.
+ */
+void ThermalPlant_init (ThermalPlant_Type * plant, float64 temperature);
+
+/*
+ * Description :
+ * Advance the plant by dt seconds with a constant heat load, ambient and fan duty (0.0 .. 1.0).
+ */
+void ThermalPlant_step (ThermalPlant_Type * plant, const ThermalSegment_Type * load, float64 duty, float64 dt);
+
+/*
+ * Description :
+ * Return the fan electrical power in W at the given duty (0.0 .. 1.0).
+ */
+float64 ThermalPlant_fanPower (const ThermalPlant_Type * plant, float64 duty);
+
+/*
+ * Description :
+ * Return the LM35 output voltage in mV for the given temperature, clamped to the sensor range.
+ */
+float64 ThermalPlant_lm35Millivolts (float64 temperature);
+
+/*
+ * Description :
+ * Build one of the synthetic scenarios: "step", "pulse" or "ramp".
+ * Returns FALSE if the name is unknown.
+ */
+bool ThermalScenario_synthetic (ThermalScenario_Type * scenario, const char * name, float64 heatPower,
+		float64 ambient, float64 duration);
+
+/*
+ * Description :
+ * Load a recorded scenario from a text file with one "time_s heat_W ambient_C"
+ * segment per line ('#' starts a comment). Returns FALSE on error.
+ */
+bool ThermalScenario_load (ThermalScenario_Type * scenario, const char * path, float64 duration);
+
+/*
+ * Description :
+ * Return the segment active at the given time, the index is a search hint
+ * updated in place so sequential lookups are O(1).
+ */
+const ThermalSegment_Type * ThermalScenario_at (const ThermalScenario_Type * scenario, float64 time, uint16 * index);
+
+#endif /* THERMAL_PLANT_H_ */
@@ -0,0 +1,193 @@
+/******************************************************************************
+ *
+ * Module: THERMAL_SIM
+ *
+ * File Name: thermal_sim.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Time-accelerated closed-loop simulator of the fan controller.
+ *              The firmware LM_35 / FAN_CONTROL / DC_MOTOR modules run on the
+ *              host board and drive a thermal model of the enclosure, then the
+ *              settling time, overshoot, duty churn, fan energy and the share of the
+ *              loop iterations with an ADC conversion are reported.
+ *
+ * Usage: thermal_sim [options]
+ *        -S NAME   control strategy, "all" runs every strategy (default firmware)
+ *        -s NAME   synthetic scenario: step, pulse or ramp (default step)
+ *        -f FILE   recorded scenario file ("time_s heat_W ambient_C" per line)
+ *        -t SEC    simulated duration in seconds (default 14400)
+ *        -P WATT   heat load of the synthetic scenarios (default 40)
+ *        -a DEG    ambient temperature of the synthetic scenarios (default 25)
+ *        -p SEC    control loop period (default 0.05)
+ *        -n DEG    LM35 noise standard deviation (default 0)
+ *        -r SEED   noise generator seed (default 1)
+ *        -o FILE   write a CSV trace of the (single strategy) run
+ *        -R FILE   record every raw ADC code of the (single strategy) run for trace_replay
+ *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "closed_loop.h"
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void ThermalSim_usage (const char * program)
+{
+	fprintf (stderr, "usage: %s [-S strategy|all] [-s step|pulse|ramp] [-f scenario_file] [-t sec] [-P W] [-a C]\n"
+			"       [-p period] [-n noise_C] [-r seed] [-o trace.csv] [-R adc_trace]\nstrategies:\n", program);
+	ClosedLoop_listStrategies (stderr);
+}
+
+static float64 ThermalSim_now (void)
+{
+	struct timespec now;
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static bool ThermalSim_runOne (const ClosedLoop_ConfigType * config, const ThermalScenario_Type * scenario,
+		const ClosedLoop_StrategyType * strategy)
+{
+	ClosedLoop_ResultType result;
+	float64 start = ThermalSim_now ();
+	float64 elapsed;
+
+	if (!ClosedLoop_run (config, scenario, strategy, NULL_PTR, &result))
+	{
+		fprintf (stderr, "%s: run failed\n", strategy->name);
+		return FALSE;
+	}
+	elapsed = ThermalSim_now () - start;
+
+	printf ("%-11s %7.2f %7.2f %7.2f %8.0f %7.1f %8lu %8.0f %9.0f %8lu %7.1f %10.0f\n", strategy->name,
+			result.peakTemperature, result.finalTemperature, result.overshoot, result.settlingTime,
+			result.meanDuty, (unsigned long)result.dutyChanges, result.dutyChurn, result.energy,
+			(unsigned long)result.pwmWrites, result.adcConversions * 100.0 / result.controlSteps,
+			(elapsed > 0.0) ? result.simulatedTime / elapsed : 0.0);
+	return TRUE;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (int argc, char * argv[])
+{
+	ClosedLoop_ConfigType config;
+	static ThermalScenario_Type scenario;
+	const char * strategyName = "firmware";
+	const char * scenarioName = "step";
+	const char * scenarioFile = NULL_PTR;
+	const char * tracePath = NULL_PTR;
+	const char * adcTracePath = NULL_PTR;
+	float64 duration = 14400.0;
+	float64 heatPower = 40.0;
+	float64 ambient = 25.0;
+	bool ok = TRUE;
+	int opt;
+
+	ClosedLoop_defaultConfig (&config);
+	while ((opt = getopt (argc, argv, "S:s:f:t:P:a:p:n:r:o:R:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'S': strategyName = optarg; break;
+		case 's': scenarioName = optarg; break;
+		case 'f': scenarioFile = optarg; break;
+		case 't': duration = atof (optarg); break;
+		case 'P': heatPower = atof (optarg); break;
+		case 'a': ambient = atof (optarg); config.initialTemperature = ambient; break;
+		case 'p': config.controlPeriod = atof (optarg); config.plantStep = config.controlPeriod; break;
+		case 'n': config.noiseSigma = atof (optarg); break;
+		case 'r': config.seed = (uint32)strtoul (optarg, NULL_PTR, 0); break;
+		case 'o': tracePath = optarg; break;
+		case 'R': adcTracePath = optarg; break;
+		default:
+			ThermalSim_usage (argv[0]);
+			return 2;
+		}
+	}
+	if ((duration <= 0.0) || (config.controlPeriod <= 0.0))
+	{
+		ThermalSim_usage (argv[0]);
+		return 2;
+	}
+
+	if (scenarioFile != NULL_PTR)
+	{
+		ok = ThermalScenario_load (&scenario, scenarioFile, duration);
+	}
+	else if (!ThermalScenario_synthetic (&scenario, scenarioName, heatPower, ambient, duration))
+	{
+		fprintf (stderr, "unknown scenario %s\n", scenarioName);
+		ok = FALSE;
+	}
+	if (!ok)
+	{
+		return 2;
+	}
+
+	if (((tracePath != NULL_PTR) || (adcTracePath != NULL_PTR)) && (strcmp (strategyName, "all") == 0))
+	{
+		fprintf (stderr, "a trace needs a single strategy\n");
+		return 2;
+	}
+	if (tracePath != NULL_PTR)
+	{
+		config.trace = fopen (tracePath, "w");
+		if (config.trace == NULL_PTR)
+		{
+			perror (tracePath);
+			return 2;
+		}
+	}
+	if (adcTracePath != NULL_PTR)
+	{
+		config.adcTrace = fopen (adcTracePath, "w");
+		if (config.adcTrace == NULL_PTR)
+		{
+			perror (adcTracePath);
+			return 2;
+		}
+	}
+
+	printf ("scenario %s, %.0f s simulated, loop period %.3f s\n", scenario.name, scenario.duration, config.controlPeriod);
+	printf ("%-11s %7s %7s %7s %8s %7s %8s %8s %9s %8s %7s %10s\n", "strategy", "peak_C", "final_C", "over_C",
+			"settle_s", "duty_%", "changes", "churn_%", "energy_J", "pwm_wr", "adc_%", "sim_s/s");
+
+	if (strcmp (strategyName, "all") == 0)
+	{
+		uint8 i;
+		for (i = 0; ClosedLoop_getStrategy (i) != NULL_PTR; i++)
+		{
+			ok &= ThermalSim_runOne (&config, &scenario, ClosedLoop_getStrategy (i));
+		}
+	}
+	else if (ClosedLoop_findStrategy (strategyName) != NULL_PTR)
+	{
+		ok = ThermalSim_runOne (&config, &scenario, ClosedLoop_findStrategy (strategyName));
+	}
+	else
+	{
+		fprintf (stderr, "unknown strategy %s\n", strategyName);
+		ThermalSim_usage (argv[0]);
+		ok = FALSE;
+	}
+
+	if (config.trace != NULL_PTR)
+	{
+		fclose (config.trace);
+	}
+	if (config.adcTrace != NULL_PTR)
+	{
+		fclose (config.adcTrace);
+	}
+	return ok ? 0 : 1;
+}
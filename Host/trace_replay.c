@@ -0,0 +1,215 @@
+/******************************************************************************
+ *
+ * Module: TRACE_REPLAY
+ *
+ * File Name: trace_replay.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Replay of a recorded ADC trace (adc_trace.h) through the unmodified
+ *              firmware path LM_35_readTemp() -> control -> DcMotor_rotate() on the
+ *              host board, as fast as possible. Every superloop iteration of the
+ *              trace is served its recorded codes and its system tick, so the
+ *              output trace is deterministic and can be compared between builds.
+ *
+ * Usage: trace_replay -i TRACE [options]
+ *        -S NAME   control strategy of the thermal simulator (default firmware)
+ *        -o FILE   write the output trace (CSV: time_ms,adc_code,duty_pct,ocr0)
+ *        -n N      replay the trace N times and report the best throughput (default 1)
+ *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "adc_trace.h"
+#include "closed_loop.h"
+#include "host_board.h"
+#include "dc_motor.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/* ADC of the host board during a replay: the codes of the current iteration in their recorded order */
+typedef struct{
+	const AdcTrace_Type * trace;
+	uint32 next;                       /* Next sample of the iteration to serve */
+	uint32 end;                        /* First sample of the next iteration */
+	uint16 lastCodes[256];             /* Last code served per channel, for the reads the trace lacks */
+	uint32 missingReads;               /* Conversions asked but not in the trace */
+} TraceReplay_SourceType;
+
+typedef struct{
+	uint32 iterations;
+	uint32 pwmWrites;
+	uint32 missingReads;
+	uint32 unusedSamples;              /* Recorded conversions the replay did not ask for */
+	float64 elapsed;                   /* s */
+} TraceReplay_ResultType;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static float64 TraceReplay_now (void)
+{
+	struct timespec now;
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static uint16 TraceReplay_adcRead (void * context, uint8 channelNum)
+{
+	TraceReplay_SourceType * source = (TraceReplay_SourceType *)context;
+	uint32 i;
+
+	/* The recorded order is normally followed exactly, search the iteration otherwise */
+	for (i = source->next; i < source->end; i++)
+	{
+		if (source->trace->samples[i].channel == channelNum)
+		{
+			source->lastCodes[channelNum] = source->trace->samples[i].code;
+			source->next = i + 1;
+			return source->lastCodes[channelNum];
+		}
+	}
+	source->missingReads++;
+	return source->lastCodes[channelNum];
+}
+
+static void TraceReplay_run (const AdcTrace_Type * trace, const ClosedLoop_StrategyType * strategy, FILE * output,
+		TraceReplay_ResultType * Result_Ptr)
+{
+	static TraceReplay_SourceType source;
+	HostBoard_Type board;
+	uint64 state[CLOSED_LOOP_MAX_STATE_SIZE / sizeof(uint64)];
+	float64 start;
+	uint32 i;
+
+	memset (&source, 0, sizeof(source));
+	memset (state, 0, sizeof(state));
+	memset (Result_Ptr, 0, sizeof(*Result_Ptr));
+	source.trace = trace;
+
+	/* Same start sequence as a simulator run */
+	HostBoard_bind (&board, TraceReplay_adcRead, &source);
+	board.ticks = trace->samples[0].timeMs / SYS_TICK_PERIOD_MS;
+	DcMotor_init ();
+	if (strategy->reset != NULL_PTR)
+	{
+		strategy->reset (state);
+	}
+	if (output != NULL_PTR)
+	{
+		fprintf (output, "time_ms,adc_code,duty_pct,ocr0\n");
+	}
+
+	start = TraceReplay_now ();
+	for (i = 0; i < trace->count; i = source.end)
+	{
+		uint32 timeMs = trace->samples[i].timeMs;
+
+		source.next = i;
+		source.end = i + 1;
+		while ((source.end < trace->count) && (trace->samples[source.end].timeMs == timeMs))
+		{
+			source.end++;
+		}
+		board.ticks = timeMs / SYS_TICK_PERIOD_MS;
+		strategy->step (state);                /* One superloop iteration */
+		Result_Ptr->unusedSamples += source.end - source.next;
+		Result_Ptr->iterations++;
+
+		if (output != NULL_PTR)
+		{
+			fprintf (output, "%lu,%u,%.2f,%u\n", (unsigned long)timeMs, trace->samples[i].code,
+					HostBoard_getFanDuty (&board) * 100.0, board.ocr0);
+		}
+	}
+	Result_Ptr->elapsed = TraceReplay_now () - start;
+	Result_Ptr->pwmWrites = board.pwmWrites;
+	Result_Ptr->missingReads = source.missingReads;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+int main (int argc, char * argv[])
+{
+	AdcTrace_Type trace;
+	TraceReplay_ResultType result;
+	const ClosedLoop_StrategyType * strategy;
+	const char * strategyName = "firmware";
+	const char * tracePath = NULL_PTR;
+	const char * outputPath = NULL_PTR;
+	FILE * output = NULL_PTR;
+	float64 best = 0.0;
+	long repeats = 1;
+	long run;
+	int opt;
+
+	while ((opt = getopt (argc, argv, "i:S:o:n:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'i': tracePath = optarg; break;
+		case 'S': strategyName = optarg; break;
+		case 'o': outputPath = optarg; break;
+		case 'n': repeats = strtol (optarg, NULL_PTR, 0); break;
+		default:
+			tracePath = NULL_PTR;
+			repeats = 0;
+			break;
+		}
+	}
+	strategy = ClosedLoop_findStrategy (strategyName);
+	if ((tracePath == NULL_PTR) || (repeats < 1) || (strategy == NULL_PTR))
+	{
+		fprintf (stderr, "usage: %s -i adc_trace [-S strategy] [-o output.csv] [-n repeats]\nstrategies:\n", argv[0]);
+		ClosedLoop_listStrategies (stderr);
+		return 2;
+	}
+	if (!AdcTrace_load (&trace, tracePath))
+	{
+		return 2;
+	}
+	if (outputPath != NULL_PTR)
+	{
+		output = fopen (outputPath, "w");
+		if (output == NULL_PTR)
+		{
+			perror (outputPath);
+			AdcTrace_free (&trace);
+			return 2;
+		}
+	}
+
+	/* The output trace comes from the first run, the throughput from the fastest one */
+	for (run = 0; run < repeats; run++)
+	{
+		TraceReplay_run (&trace, strategy, (run == 0) ? output : NULL_PTR, &result);
+		if ((run == 0) || (result.elapsed < best))
+		{
+			best = result.elapsed;
+		}
+	}
+	if (output != NULL_PTR)
+	{
+		fclose (output);
+	}
+
+	printf ("%s: %lu samples, %lu iterations, %.0f s of trace, strategy %s\n", tracePath, (unsigned long)trace.count,
+			(unsigned long)result.iterations, (trace.samples[trace.count - 1].timeMs - trace.samples[0].timeMs) / 1000.0,
+			strategy->name);
+	printf ("pwm writes %lu, missing conversions %lu, unused samples %lu\n", (unsigned long)result.pwmWrites,
+			(unsigned long)result.missingReads, (unsigned long)result.unusedSamples);
+	printf ("best of %ld: %.3f ms, %.0f samples/s\n", repeats, best * 1e3, (best > 0.0) ? trace.count / best : 0.0);
+
+	AdcTrace_free (&trace);
+	return ((result.missingReads != 0) || (result.unusedSamples != 0)) ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+Module: SRAM report
+
+File Name: sram_report.py
+
+Author: Mohamed Nasser
+
+Date Created: Oct 19, 2026
+
+Description: Build-time SRAM budget report generated from the linker map file.
+             Prints the .data/.bss/.noinit bytes contributed by every module,
+             the total static SRAM and the headroom left for the stack, and
+             fails when the headroom is below the required stack reserve.
+             Also lists the floating point and libm routines linked in, with
+             their flash bytes, and fails on any of them with --no-float.
+
+Usage: sram_report.py [--ram-size BYTES] [--stack-reserve BYTES] [--no-float] Mini_Project3.map
+"""
+
+import argparse
+import os
+import re
+import sys
+
+RAM_SECTIONS = (".data", ".bss", ".noinit")
+FLASH_SECTION = ".text"
+
+# libm members are the avr-libc float routines (and ceil, sqrt...), the libgcc
+# soft-float members carry the mode in their name (_addsub_sf.o, _fixunssfsi.o)
+FLOAT_MODULE = re.compile(r"^libm\.a\(|^libgcc\.a\(.*(sf|df)")
+
+# " .bss.g_motorState 0x00800186 0x1 ./project.o", the name can also be alone
+# on its line when it is long, the address/size/file then follow on the next one
+INPUT_SECTION = re.compile(r"^ (\.\S+)\s*$|^ (\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(.+)$")
+CONTINUATION = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+OUTPUT_SECTION = re.compile(r"^(\.\S+)")
+
+
+def module_name(path):
+    """Return a short module name for an object file or an archive member."""
+    member = re.search(r"\(([^)]+)\)$", path)
+    if member:
+        archive = os.path.basename(path[:member.start()].replace("\\", "/"))
+        return "%s(%s)" % (archive, member.group(1))
+    return os.path.basename(path.replace("\\", "/"))
+
+
+def section_kind(section):
+    for kind in RAM_SECTIONS + (FLASH_SECTION,):
+        if section == kind or section.startswith(kind + "."):
+            return kind
+    return None
+
+
+def parse_map(lines):
+    """Return {module: {section kind: bytes}} for the SRAM and .text output sections."""
+    usage = {}
+    current_output = None
+    pending = None
+
+    for line in lines:
+        line = line.rstrip("\n")
+        output = OUTPUT_SECTION.match(line)
+        if output:
+            current_output = output.group(1)
+            pending = None
+            continue
+        if section_kind(current_output or "") is None:
+            continue
+
+        if pending:
+            cont = CONTINUATION.match(line)
+            if cont:
+                size = int(cont.group(2), 16)
+                if size:
+                    mod = usage.setdefault(module_name(cont.group(3).strip()), {})
+                    mod[pending] = mod.get(pending, 0) + size
+            pending = None
+            continue
+
+        entry = INPUT_SECTION.match(line)
+        if not entry:
+            continue
+        if entry.group(1):
+            pending = section_kind(entry.group(1))
+            continue
+        kind = section_kind(entry.group(2))
+        size = int(entry.group(4), 16)
+        if kind and size:
+            mod = usage.setdefault(module_name(entry.group(5).strip()), {})
+            mod[kind] = mod.get(kind, 0) + size
+    return usage
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("Usage:")[0].strip())
+    parser.add_argument("map_file")
+    parser.add_argument("--ram-size", type=int, default=2048, help="SRAM size in bytes (ATmega32: 2048)")
+    parser.add_argument("--stack-reserve", type=int, default=256,
+                        help="minimum headroom in bytes required for the stack")
+    parser.add_argument("--no-float", action="store_true",
+                        help="fail when any floating point or libm routine is linked")
+    args = parser.parse_args()
+
+    with open(args.map_file, errors="replace") as map_file:
+        usage = parse_map(map_file)
+
+    totals = dict.fromkeys(RAM_SECTIONS, 0)
+    print("%-40s %7s %7s %7s %7s" % ("Module", ".data", ".bss", ".noinit", "Total"))
+    ram_usage = dict((name, kinds) for name, kinds in usage.items() if any(k in kinds for k in RAM_SECTIONS))
+    for name in sorted(ram_usage, key=lambda n: -sum(ram_usage[n].get(k, 0) for k in RAM_SECTIONS)):
+        sizes = [usage[name].get(kind, 0) for kind in RAM_SECTIONS]
+        for kind, size in zip(RAM_SECTIONS, sizes):
+            totals[kind] += size
+        print("%-40s %7d %7d %7d %7d" % ((name,) + tuple(sizes) + (sum(sizes),)))
+
+    static = sum(totals.values())
+    headroom = args.ram_size - static
+    print("%-40s %7d %7d %7d %7d" % (("TOTAL",) + tuple(totals[k] for k in RAM_SECTIONS) + (static,)))
+    print("Static SRAM: %d of %d bytes (%.1f%%)" % (static, args.ram_size, 100.0 * static / args.ram_size))
+    print("Stack/heap headroom: %d bytes (reserve %d bytes)" % (headroom, args.stack_reserve))
+
+    flash = sum(kinds.get(FLASH_SECTION, 0) for kinds in usage.values())
+    floats = dict((name, kinds[FLASH_SECTION]) for name, kinds in usage.items()
+                  if FLASH_SECTION in kinds and FLOAT_MODULE.search(name))
+    print("Code: %d bytes of .text, %d bytes in %d floating point/libm routines" %
+          (flash, sum(floats.values()), len(floats)))
+    for name in sorted(floats, key=lambda n: -floats[n]):
+        print("  %-38s %7d" % (name, floats[name]))
+
+    status = 0
+    if headroom < args.stack_reserve:
+        print("error: SRAM budget exceeded, headroom is below the stack reserve", file=sys.stderr)
+        status = 1
+    if args.no_float and floats:
+        print("error: floating point routines are linked, use fixed_point.h instead", file=sys.stderr)
+        status = 1
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -15,7 +15,82 @@
 #include "adc.h"
 #include "common_macros.h"
 #include "std_types.h"
+#include "fixed_point.h"
+#include "timer.h"
 #include <avr/io.h>
+#include <util/atomic.h>
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* nominal reference / actual reference in Q2.14 */
+static uint16 g_correction = ADC_CORRECTION_ONE;
+static bool g_calibrated = FALSE;
+static bool g_pwmSync = ADC_PWM_SYNC;
+
+static uint32 g_conversions = 0;
+static uint16 g_conversionTime = 0;      /* Microseconds, set from the prescaler */
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Start the conversion in the middle of the longer phase of the motor PWM. The non-inverted
+ * fast PWM drives the motor from BOTTOM up to the compare match and leaves it off up to TOP,
+ * so the middle of the on phase is OCR0 / 2 and the middle of the off phase is 128 counts
+ * later. The longer phase has at least 128 counts, so with the start window the sample and
+ * hold (1.5 ADC clocks after the start) stays at least 56 counts (448 us at 1 MHz) from the
+ * turn-off flyback and from the turn-on edge. The
+ * counter is checked and the conversion started with the interrupts disabled, a window
+ * missed because of an interrupt waits for the next period.
+ */
+static void ADC_startAtPwmMiddle (void)
+{
+	uint8 compare = (uint8)Timer_getCompare (TIMER0_ID, TIMER_CHANNEL_A);
+	uint8 target = compare / 2;
+	bool started = FALSE;
+
+	if (compare < (ADC_PWM_PERIOD_COUNTS / 2))
+	{
+		target += (ADC_PWM_PERIOD_COUNTS / 2);      /* The off phase is the longer one */
+	}
+	while (!started)
+	{
+		ATOMIC_BLOCK (ATOMIC_RESTORESTATE)
+		{
+			if ((uint8)((uint8)Timer_getCount (TIMER0_ID) - target) < ADC_SYNC_WINDOW_COUNTS)
+			{
+				SET_BIT (ADCSRA, ADSC);
+				started = TRUE;
+			}
+		}
+	}
+}
+
+/*
+ * Description :
+ * Convert the given channel (MUX4:0) and return the uncorrected code.
+ */
+static uint16 ADC_convert (uint8 channelNum)
+{
+	ADMUX = (ADMUX & 0xE0) | (channelNum & 0x1F);   /* Selects the ADC channel and puts it in ADMUX register */
+
+	if (g_pwmSync && Timer_isRunning (TIMER0_ID))
+	{
+		ADC_startAtPwmMiddle ();
+	}
+	else
+	{
+		SET_BIT (ADCSRA, ADSC);  			   		/* Start the conversion for this channel */
+	}
+	while (BIT_IS_CLEAR (ADCSRA, ADIF)); 	        /* polling on the flag until the conversion is done */
+	SET_BIT (ADCSRA, ADIF);    				        /* Reset the flag by putting logic high */
+	g_conversions++;
+	return (ADC & 0x03FF);     					    /* Returning the digital value after conversion */
+}
 
 /*******************************************************************************
  *                          Functions Definitions                              *
@@ -33,6 +108,10 @@ void ADC_init(const ADC_ConfigType * Config_Ptr)
 	/* Puts the input value of prescaler in ADCSRA register first 3 bits */
 	ADCSRA = (ADCSRA & 0xF8) | ((Config_Ptr -> prescaler) & 0x07);
 
+	/* The ADC clock is F_CPU / 2^prescaler, a conversion takes 13 of them (the first one 25) */
+	g_conversionTime = (uint16)(((uint32)ADC_CONVERSION_CLOCKS * (1UL << ((Config_Ptr -> prescaler) & 0x07)) * 1000000UL) / F_CPU);
+	g_conversions = 0;
+
 	SET_BIT (ADCSRA, ADEN);           /* Enables the ADC peripheral */
 }
 
@@ -40,14 +119,110 @@ void ADC_init(const ADC_ConfigType * Config_Ptr)
  * Description :
  * Function responsible for read analog data from a certain ADC channel
  * and convert it to digital using the ADC driver.
+ * With ADC_VREF_CALIBRATION the value is scaled to the nominal reference by the
+ * correction factor of the last calibration (one multiply and shift).
  */
 uint16 ADC_readChannel (uint8 channelNum)
 {
-	ADMUX = (ADMUX & 0xE0) | (channelNum & 0x07);   /* Selects the ADC channel and puts it in ADMUX register */
-	SET_BIT (ADCSRA, ADSC);  			   		    /* Start the conversion for this channel */
-	while (BIT_IS_CLEAR (ADCSRA, ADIF)); 	        /* polling on the flag until the conversion is done */
-	SET_BIT (ADCSRA, ADIF);    				        /* Reset the flag by putting logic high */
-	return (ADC & 0x03FF);     					    /* Returning the digital value after conversion */
+	uint16 code = ADC_convert (channelNum & 0x07);
+
+#if (ADC_VREF_CALIBRATION == 1)
+	uint32 corrected = (uint32)Fixed_mulShift (code, g_correction, ADC_CORRECTION_SHIFT);
+	code = (corrected > ADC_MAX_DIGITAL_VALUE) ? ADC_MAX_DIGITAL_VALUE : (uint16)corrected;
+#endif
+	return code;
+}
+
+/*
+ * Description :
+ * Select how the conversions start: TRUE to start them in the middle of the longer
+ * phase of the motor PWM (on or off), half a phase away from both switching edges,
+ * FALSE to start them at once. A synchronized conversion waits up to one PWM period,
+ * and starts at once while Timer0 is stopped.
+ */
+void ADC_setPwmSync (bool enable)
+{
+	g_pwmSync = enable;
+}
+
+/*
+ * Description :
+ * Return TRUE if the conversions are synchronized to the motor PWM.
+ */
+bool ADC_getPwmSync (void)
+{
+	return g_pwmSync;
+}
+
+/*
+ * Description :
+ * Measure the bandgap voltage against the selected reference and update the
+ * reference correction factor, takes ADC_CALIBRATION_SAMPLES + 1 conversions.
+ * Returns FALSE if the measurement is out of tolerance (the factor is kept).
+ */
+bool ADC_calibrate (void)
+{
+	uint16 sum = 0;
+	uint16 measured;
+	uint16 factor;
+	uint8 i;
+
+	/* The first conversion after selecting the bandgap is taken before it settled */
+	ADC_convert (ADC_BANDGAP_CHANNEL);
+	for (i = 0; i < ADC_CALIBRATION_SAMPLES; i++)
+	{
+		sum += ADC_convert (ADC_BANDGAP_CHANNEL);
+	}
+	measured = (sum + (ADC_CALIBRATION_SAMPLES / 2)) / ADC_CALIBRATION_SAMPLES;
+
+	if ((measured < ADC_BANDGAP_NOMINAL_CODE - ADC_BANDGAP_TOLERANCE_CODE) ||
+			(measured > ADC_BANDGAP_NOMINAL_CODE + ADC_BANDGAP_TOLERANCE_CODE))
+	{
+		return FALSE;
+	}
+
+	/* A low reference gives a high bandgap code, the readings are scaled down by the same ratio */
+	factor = (uint16)((((uint32)ADC_BANDGAP_NOMINAL_CODE * ADC_CALIBRATION_SAMPLES) << ADC_CORRECTION_SHIFT) / sum);
+
+	/* First order filter so the conversion noise of one calibration does not step every reading */
+	if (g_calibrated)
+	{
+		g_correction = (uint16)(g_correction + ((sint16)(factor - g_correction) >> 2));
+	}
+	else
+	{
+		g_correction = factor;
+		g_calibrated = TRUE;
+	}
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Return the reference correction factor in Q2.14 (ADC_CORRECTION_ONE for an exact reference).
+ */
+uint16 ADC_getCorrection (void)
+{
+	return g_correction;
+}
+
+/*
+ * Description :
+ * Return the number of conversions done since the initialization, calibrations included.
+ */
+uint32 ADC_getConversions (void)
+{
+	return g_conversions;
+}
+
+/*
+ * Description :
+ * Return the time of one conversion in microseconds with the configured prescaler,
+ * the ADC busy time is this times the number of conversions.
+ */
+uint16 ADC_getConversionTime (void)
+{
+	return g_conversionTime;
 }
 
 /*
@@ -22,9 +22,28 @@
  *                                Definitions                                  *
  *******************************************************************************/
 
+/* Static Configurations, 1 = correct every reading for the measured reference drift */
+#define ADC_VREF_CALIBRATION                     1
+#define ADC_CALIBRATION_PERIOD_MS                10000
+#define ADC_CALIBRATION_SAMPLES                  4
+#define ADC_BANDGAP_VOLTAGE                      1.22     /* Typical, replace with the value measured on the part */
+
+/* Static Configurations, 1 = start the conversions in the middle of the longer phase of the Timer0 motor PWM */
+#define ADC_PWM_SYNC                             1
+
 /* Parameters Definitions */
 #define ADC_VOLTAGE_REFERENCE                    2.56
 #define ADC_MAX_DIGITAL_VALUE                    1023
+#define ADC_BANDGAP_CHANNEL                      0x1E
+#define ADC_CORRECTION_SHIFT                     14       /* The correction factor is Q2.14 */
+#define ADC_CORRECTION_ONE                       ((uint16)1 << ADC_CORRECTION_SHIFT)
+#define ADC_PWM_PERIOD_COUNTS                    256      /* Timer0 counts of one fast PWM period */
+#define ADC_SYNC_WINDOW_COUNTS                   8        /* A start later than this after the middle waits for the next period */
+#define ADC_CONVERSION_CLOCKS                    13       /* ADC clocks of a single conversion */
+
+/* Bandgap code expected with an exact reference, a measured code off by more than 1/8 is rejected */
+#define ADC_BANDGAP_NOMINAL_CODE                 ((uint16)(ADC_BANDGAP_VOLTAGE / ADC_VOLTAGE_REFERENCE * (ADC_MAX_DIGITAL_VALUE + 1) + 0.5))
+#define ADC_BANDGAP_TOLERANCE_CODE               (ADC_BANDGAP_NOMINAL_CODE / 8)
 
 /*******************************************************************************
  *                               Enumerations                                  *
@@ -60,9 +79,53 @@ void ADC_init(const ADC_ConfigType * Config_Ptr);
  * Description :
  * Function responsible for read analog data from a certain ADC channel
  * and convert it to digital using the ADC driver.
+ * With ADC_VREF_CALIBRATION the value is scaled to the nominal reference by the
+ * correction factor of the last calibration (one multiply and shift).
  */
 uint16 ADC_readChannel (uint8 channelNum);
 
+/*
+ * Description :
+ * Select how the conversions start: TRUE to start them in the middle of the longer
+ * phase of the motor PWM (on or off), half a phase away from both switching edges,
+ * FALSE to start them at once. A synchronized conversion waits up to one PWM period,
+ * and starts at once while Timer0 is stopped.
+ */
+void ADC_setPwmSync (bool enable);
+
+/*
+ * Description :
+ * Return TRUE if the conversions are synchronized to the motor PWM.
+ */
+bool ADC_getPwmSync (void);
+
+/*
+ * Description :
+ * Measure the bandgap voltage against the selected reference and update the
+ * reference correction factor, takes ADC_CALIBRATION_SAMPLES + 1 conversions.
+ * Returns FALSE if the measurement is out of tolerance (the factor is kept).
+ */
+bool ADC_calibrate (void);
+
+/*
+ * Description :
+ * Return the reference correction factor in Q2.14 (ADC_CORRECTION_ONE for an exact reference).
+ */
+uint16 ADC_getCorrection (void);
+
+/*
+ * Description :
+ * Return the number of conversions done since the initialization, calibrations included.
+ */
+uint32 ADC_getConversions (void);
+
+/*
+ * Description :
+ * Return the time of one conversion in microseconds with the configured prescaler,
+ * the ADC busy time is this times the number of conversions.
+ */
+uint16 ADC_getConversionTime (void);
+
 /*
  * Description :
  * Function responsible for de-initialize the ADC peripheral.
@@ -0,0 +1,305 @@
+/******************************************************************************
+ *
+ * Module: AUTOTUNE
+ *
+ * File Name: autotune.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the relay-feedback auto-tuning of the PID gains
+ *
+ *******************************************************************************/
+
+#include "autotune.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Half the relay swing in percent, the amplitude d of the describing function */
+#define AUTOTUNE_RELAY_AMPLITUDE                 ((AUTOTUNE_HIGH_SPEED - AUTOTUNE_LOW_SPEED) / 2)
+
+/* 4 / pi in Q8.24: Ku = 4d / (pi a) in Q16.16 with a in Q8.8 */
+#define AUTOTUNE_FOUR_OVER_PI                    21361415UL
+
+/* The relay and the tuned controller share the fixed update period of Pid_update */
+#define AUTOTUNE_PERIOD_TICKS                    SYS_TICK_MS_TO_TICKS (PID_PERIOD_MS)
+#define AUTOTUNE_TICKS_TO_UPDATES(TICKS)         (((TICKS) + AUTOTUNE_PERIOD_TICKS / 2) / AUTOTUNE_PERIOD_TICKS)
+
+#if (AUTOTUNE_RELAY_AMPLITUDE > 50)
+#error "The relay swing must be at most 100 percent"
+#endif
+#if ((PID_PERIOD_MS % SYS_TICK_PERIOD_MS) != 0) || (PID_PERIOD_MS == 0)
+#error "The PID period must be a multiple of the system tick"
+#endif
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static void (*g_callBackPtr)(const Autotune_ResultType * Result_Ptr) = NULL_PTR;
+
+static Autotune_StateType g_state = AUTOTUNE_IDLE;
+static Autotune_ResultType g_result;
+static bool g_resultValid = FALSE;
+
+static sint16 g_setpoint;
+static sint16 g_filtered;
+static bool g_firstUpdate;
+static bool g_relayHigh;
+static uint32 g_startTick;
+static uint32 g_nextUpdateTick;
+
+/* Current oscillation cycle, from one switch of the relay to high to the next */
+static uint8 g_cycles;
+static bool g_cycleStarted;
+static uint32 g_cycleStartTick;
+static sint16 g_cycleMax;
+static sint16 g_cycleMin;
+
+/* Sums over the measured cycles */
+static uint32 g_sumTicks;
+static sint32 g_sumAmplitude;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+static sint32 Autotune_limitGain (uint32 gain)
+{
+	return (gain > AUTOTUNE_MAX_GAIN) ? AUTOTUNE_MAX_GAIN : (sint32)gain;
+}
+
+/*
+ * Description :
+ * Turn the mean period and amplitude into the ultimate gain and the PID gains.
+ * The describing function of the relay gives Ku = 4d / (pi a) (Astrom-Hagglund),
+ * an amplitude within the hysteresis band means the relay did not really oscillate.
+ * The period is measured in system ticks, the integral and derivative times are
+ * turned into PID_PERIOD_MS updates, the units of the per-update gains of Pid_update.
+ * Returns FALSE if the oscillation is too small to be measured.
+ */
+static bool Autotune_computeGains (void)
+{
+	uint32 amplitude = (uint32)(g_sumAmplitude / AUTOTUNE_NUM_OF_CYCLES);
+	uint32 ultimateGain;
+	uint32 kp;
+	uint32 integralTime;
+	uint32 derivativeTime;
+
+	if (amplitude <= AUTOTUNE_HYSTERESIS)
+	{
+		return FALSE;
+	}
+
+	g_result.periodTicks = g_sumTicks / AUTOTUNE_NUM_OF_CYCLES;
+	g_result.amplitude = (sint16)amplitude;
+
+	ultimateGain = (AUTOTUNE_RELAY_AMPLITUDE * AUTOTUNE_FOUR_OVER_PI) / amplitude;
+	g_result.ultimateGain = Autotune_limitGain (ultimateGain);
+
+	kp = ((uint32)g_result.ultimateGain * AUTOTUNE_KP_FACTOR) >> AUTOTUNE_FACTOR_SHIFT;
+	integralTime = AUTOTUNE_TICKS_TO_UPDATES ((g_result.periodTicks * AUTOTUNE_TI_FACTOR) >> AUTOTUNE_FACTOR_SHIFT);
+	derivativeTime = AUTOTUNE_TICKS_TO_UPDATES ((g_result.periodTicks * AUTOTUNE_TD_FACTOR) >> AUTOTUNE_FACTOR_SHIFT);
+
+	g_result.gains.kp = Autotune_limitGain (kp);
+	g_result.gains.ki = (integralTime > 0) ? Autotune_limitGain (kp / integralTime) : 0;
+	if ((kp != 0) && (derivativeTime > AUTOTUNE_MAX_GAIN / kp))
+	{
+		g_result.gains.kd = AUTOTUNE_MAX_GAIN;
+	}
+	else
+	{
+		g_result.gains.kd = Autotune_limitGain (kp * derivativeTime);
+	}
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Close the current oscillation cycle at a switch of the relay to high and
+ * finish the tuning once enough cycles are measured.
+ */
+static void Autotune_closeCycle (void)
+{
+	if (g_cycleStarted)
+	{
+		g_cycles++;
+		if (g_cycles > AUTOTUNE_SETTLE_CYCLES)
+		{
+			g_sumTicks += SysTick_getTicks () - g_cycleStartTick;
+			g_sumAmplitude += (g_cycleMax - g_cycleMin) / 2;
+		}
+		if (g_cycles >= AUTOTUNE_SETTLE_CYCLES + AUTOTUNE_NUM_OF_CYCLES)
+		{
+			if (Autotune_computeGains ())
+			{
+				g_state = AUTOTUNE_DONE;
+				g_resultValid = TRUE;
+				if (g_callBackPtr != NULL_PTR)
+				{
+					(*g_callBackPtr)(&g_result);
+				}
+			}
+			else
+			{
+				g_state = AUTOTUNE_FAILED;
+			}
+			return;
+		}
+	}
+	g_cycleStarted = TRUE;
+	g_cycleStartTick = SysTick_getTicks ();
+	g_cycleMax = g_filtered;
+	g_cycleMin = g_filtered;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Save the address of the function called with the result once a tuning succeeds,
+ * e.g. to hand the gains to the controller and store them.
+ */
+void Autotune_setCallBack (void (*a_ptr)(const Autotune_ResultType * Result_Ptr))
+{
+	g_callBackPtr = a_ptr;
+}
+
+/*
+ * Description :
+ * Start a tuning around the given setpoint in Celsius, the fan is then driven by
+ * the relay output of Autotune_update until the tuning ends.
+ */
+void Autotune_start (sint16 setpoint)
+{
+	g_setpoint = setpoint * 256;
+	g_firstUpdate = TRUE;
+	g_startTick = SysTick_getTicks ();
+	g_nextUpdateTick = g_startTick;
+	g_cycles = 0;
+	g_cycleStarted = FALSE;
+	g_sumTicks = 0;
+	g_sumAmplitude = 0;
+	g_state = AUTOTUNE_RUNNING;
+}
+
+/*
+ * Description :
+ * Stop a running tuning, its state becomes AUTOTUNE_FAILED.
+ */
+void Autotune_abort (void)
+{
+	if (g_state == AUTOTUNE_RUNNING)
+	{
+		g_state = AUTOTUNE_FAILED;
+	}
+}
+
+/*
+ * Description :
+ * Called every loop iteration of a running tuning with the temperature in Q8.8 C,
+ * works every PID_PERIOD_MS and returns the held relay output in between:
+ * 1. Filter the temperature and switch the relay when it leaves the hysteresis band.
+ * 2. Measure the period and amplitude of every oscillation cycle.
+ * 3. After the required cycles compute the gains and call the callback.
+ * Returns the fan speed in percent of the relay, constant time per call.
+ */
+uint8 Autotune_update (sint16 temperature)
+{
+	if (g_state != AUTOTUNE_RUNNING)
+	{
+		return AUTOTUNE_LOW_SPEED;
+	}
+
+	/* The filter weight and the tuned gains are per update, so the updates keep a fixed period */
+	if ((sint32)(SysTick_getTicks () - g_nextUpdateTick) < 0)
+	{
+		return g_relayHigh ? AUTOTUNE_HIGH_SPEED : AUTOTUNE_LOW_SPEED;
+	}
+	g_nextUpdateTick += AUTOTUNE_PERIOD_TICKS;
+	if ((sint32)(SysTick_getTicks () - g_nextUpdateTick) >= 0)
+	{
+		g_nextUpdateTick = SysTick_getTicks () + AUTOTUNE_PERIOD_TICKS;      /* A late loop restarts the period */
+	}
+
+	if (g_firstUpdate)
+	{
+		g_filtered = temperature;
+		g_relayHigh = (temperature > g_setpoint) ? TRUE : FALSE;
+		g_firstUpdate = FALSE;
+	}
+	else
+	{
+		g_filtered += (temperature - g_filtered) / (1 << AUTOTUNE_FILTER_SHIFT);
+	}
+
+	if ((sint32)(SysTick_getTicks () - g_startTick) >= (sint32)SYS_TICK_MS_TO_TICKS (AUTOTUNE_TIMEOUT_S * 1000UL))
+	{
+		g_state = AUTOTUNE_FAILED;
+		return AUTOTUNE_LOW_SPEED;
+	}
+
+	if (g_filtered > g_cycleMax)
+	{
+		g_cycleMax = g_filtered;
+	}
+	if (g_filtered < g_cycleMin)
+	{
+		g_cycleMin = g_filtered;
+	}
+
+	/* Reverse acting process: the fan cools, so it runs fast above the setpoint */
+	if ((!g_relayHigh) && (g_filtered > g_setpoint + AUTOTUNE_HYSTERESIS))
+	{
+		g_relayHigh = TRUE;
+		Autotune_closeCycle ();
+	}
+	else if (g_relayHigh && (g_filtered < g_setpoint - AUTOTUNE_HYSTERESIS))
+	{
+		g_relayHigh = FALSE;
+	}
+
+	if (g_state != AUTOTUNE_RUNNING)
+	{
+		return AUTOTUNE_LOW_SPEED;
+	}
+	return g_relayHigh ? AUTOTUNE_HIGH_SPEED : AUTOTUNE_LOW_SPEED;
+}
+
+/*
+ * Description :
+ * Return the state of the tuning.
+ */
+Autotune_StateType Autotune_getState (void)
+{
+	return g_state;
+}
+
+/*
+ * Description :
+ * Return the number of oscillation cycles measured so far, the settling ones included.
+ */
+uint8 Autotune_getCycles (void)
+{
+	return g_cycles;
+}
+
+/*
+ * Description :
+ * Copy the result of the last successful tuning.
+ * Returns FALSE if no tuning succeeded yet.
+ */
+bool Autotune_getResult (Autotune_ResultType * Result_Ptr)
+{
+	if (!g_resultValid)
+	{
+		return FALSE;
+	}
+	*Result_Ptr = g_result;
+	return TRUE;
+}
@@ -0,0 +1,125 @@
+/******************************************************************************
+ *
+ * Module: AUTOTUNE
+ *
+ * File Name: autotune.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the relay-feedback auto-tuning of the PID gains
+ *
+ *******************************************************************************/
+
+#ifndef AUTOTUNE_H_
+#define AUTOTUNE_H_
+
+#include "std_types.h"
+#include "fixed_point.h"
+#include "pid_controller.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define AUTOTUNE_HIGH_SPEED                      100        /* Relay output above the setpoint in percent */
+#define AUTOTUNE_LOW_SPEED                       0          /* Relay output below the setpoint in percent */
+#define AUTOTUNE_HYSTERESIS                      AUTOTUNE_CELSIUS(0.5)
+#define AUTOTUNE_FILTER_SHIFT                    3          /* First order filter of the temperature, 1/8 per update */
+#define AUTOTUNE_SETTLE_CYCLES                   1          /* Oscillation cycles ignored while the loop settles */
+#define AUTOTUNE_NUM_OF_CYCLES                   3          /* Oscillation cycles averaged for the result */
+#define AUTOTUNE_TIMEOUT_S                       7200UL
+
+/*
+ * Tuning rule applied to the ultimate gain Ku and period Pu of the oscillation:
+ *   kp = KP_FACTOR * Ku, Ti = TI_FACTOR * Pu, Td = TD_FACTOR * Pu
+ * Ziegler-Nichols PI is 0.45 / 0.83 / 0, Ziegler-Nichols PID is 0.6 / 0.5 / 0.125
+ * and the no overshoot variant is 0.2 / 0.5 / 0.33. The derivative of Pid_update
+ * has no filter and sees whole degrees, so the PI rule is the default.
+ */
+#define AUTOTUNE_KP_FACTOR                       AUTOTUNE_FACTOR(0.45)
+#define AUTOTUNE_TI_FACTOR                       AUTOTUNE_FACTOR(0.83)
+#define AUTOTUNE_TD_FACTOR                       AUTOTUNE_FACTOR(0.0)
+
+/* Highest tuned gain, keeps every term of Pid_update in 32 bits whatever the error */
+#define AUTOTUNE_MAX_GAIN                        PID_GAIN(32.0)
+
+/* Parameters Definitions */
+#define AUTOTUNE_CELSIUS(VALUE)                  FIXED_Q8_8(VALUE)
+#define AUTOTUNE_FACTOR(VALUE)                   ((uint16)((VALUE) * 256.0 + 0.5))
+#define AUTOTUNE_FACTOR_SHIFT                    8
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	AUTOTUNE_IDLE, AUTOTUNE_RUNNING, AUTOTUNE_DONE, AUTOTUNE_FAILED
+} Autotune_StateType;
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	uint32 periodTicks;                /* Mean oscillation period Pu in system ticks */
+	sint16 amplitude;                  /* Mean half peak to peak amplitude in Q8.8 C */
+	sint32 ultimateGain;               /* Ku in Q16.16 percent per Celsius */
+	Pid_GainsType gains;               /* Tuned gains per controller update */
+} Autotune_ResultType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Save the address of the function called with the result once a tuning succeeds,
+ * e.g. to hand the gains to the controller and store them.
+ */
+void Autotune_setCallBack (void (*a_ptr)(const Autotune_ResultType * Result_Ptr));
+
+/*
+ * Description :
+ * Start a tuning around the given setpoint in Celsius, the fan is then driven by
+ * the relay output of Autotune_update until the tuning ends.
+ */
+void Autotune_start (sint16 setpoint);
+
+/*
+ * Description :
+ * Stop a running tuning, its state becomes AUTOTUNE_FAILED.
+ */
+void Autotune_abort (void);
+
+/*
+ * Description :
+ * Called every loop iteration of a running tuning with the temperature in Q8.8 C:
+ * 1. Filter the temperature and switch the relay when it leaves the hysteresis band.
+ * 2. Measure the period and amplitude of every oscillation cycle.
+ * 3. After the required cycles compute the gains and call the callback.
+ * Returns the fan speed in percent of the relay, constant time per call.
+ */
+uint8 Autotune_update (sint16 temperature);
+
+/*
+ * Description :
+ * Return the state of the tuning.
+ */
+Autotune_StateType Autotune_getState (void);
+
+/*
+ * Description :
+ * Return the number of oscillation cycles measured so far, the settling ones included.
+ */
+uint8 Autotune_getCycles (void);
+
+/*
+ * Description :
+ * Copy the result of the last successful tuning.
+ * Returns FALSE if no tuning succeeded yet.
+ */
+bool Autotune_getResult (Autotune_ResultType * Result_Ptr);
+
+#endif /* AUTOTUNE_H_ */
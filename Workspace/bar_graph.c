@@ -0,0 +1,152 @@
+/******************************************************************************
+ *
+ * Module: BAR_GRAPH
+ *
+ * File Name: bar_graph.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the LCD bar graph of the fan speed, drawn with
+ *              custom CGRAM glyphs at one pixel column resolution.
+ *
+ *******************************************************************************/
+
+#include <avr/pgmspace.h>
+#include "bar_graph.h"
+#include "lcd.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Glyphs of 1 to 5 filled columns from the left, the top and bottom pixel rows are kept empty */
+static const uint8 g_glyphs[BAR_GRAPH_COLUMNS_PER_CELL][8] PROGMEM = {
+	{0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00},
+	{0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00},
+	{0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00},
+	{0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x00},
+	{0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00}
+};
+
+/* Filled columns (0 .. 5) shown in each cell, BAR_GRAPH_NOT_DRAWN if unknown */
+static uint8 g_cells[BAR_GRAPH_NUM_OF_CELLS];
+static BarGraph_StatsType g_stats = {0, 0};
+
+/* Next glyph loaded by BarGraph_initStep */
+static uint8 g_nextGlyph = 0;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Load the glyph set from the flash memory into the LCD CGRAM, this is the only
+ * CGRAM write of the bar graph so it must be called once after LCD_init.
+ * The whole bar is drawn by the next update.
+ */
+void BarGraph_init (void)
+{
+	g_nextGlyph = 0;
+	while (!BarGraph_initStep ());
+}
+
+/*
+ * Description :
+ * Incremental form of BarGraph_init for a boot which must not block: every call loads
+ * the next glyph and returns TRUE once the glyph set is loaded and the bar invalidated.
+ */
+bool BarGraph_initStep (void)
+{
+	if (g_nextGlyph < BAR_GRAPH_COLUMNS_PER_CELL)
+	{
+		LCD_createCharacter_P (BAR_GRAPH_FIRST_GLYPH + g_nextGlyph, g_glyphs[g_nextGlyph]);
+		g_nextGlyph++;
+		if (g_nextGlyph < BAR_GRAPH_COLUMNS_PER_CELL)
+		{
+			return FALSE;
+		}
+		g_stats.cellWrites = 0;
+		g_stats.cellSkips = 0;
+		BarGraph_invalidate ();
+	}
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Forget the drawn cells so the next update redraws the whole bar,
+ * used after the bar area of the screen was overwritten or cleared.
+ */
+void BarGraph_invalidate (void)
+{
+	uint8 i;
+
+	for (i = 0; i < BAR_GRAPH_NUM_OF_CELLS; i++)
+	{
+		g_cells[i] = BAR_GRAPH_NOT_DRAWN;
+	}
+}
+
+/*
+ * Description :
+ * Show the given value (0 .. BAR_GRAPH_MAX_VALUE) as a bar of filled pixel columns,
+ * only the cells whose glyph changed since the last update are sent to the LCD.
+ */
+void BarGraph_update (uint8 value)
+{
+	uint8 columns;
+	uint8 level;
+	uint8 i;
+	bool cursorInPlace = FALSE;
+
+	if (value > BAR_GRAPH_MAX_VALUE)
+	{
+		value = BAR_GRAPH_MAX_VALUE;
+	}
+	/* Rounded number of filled pixel columns over the whole bar */
+	columns = (uint8)(((uint16)value * BAR_GRAPH_NUM_OF_COLUMNS + (BAR_GRAPH_MAX_VALUE / 2)) / BAR_GRAPH_MAX_VALUE);
+
+	for (i = 0; i < BAR_GRAPH_NUM_OF_CELLS; i++)
+	{
+		if (columns >= BAR_GRAPH_COLUMNS_PER_CELL)
+		{
+			level = BAR_GRAPH_COLUMNS_PER_CELL;
+			columns -= BAR_GRAPH_COLUMNS_PER_CELL;
+		}
+		else
+		{
+			level = columns;
+			columns = 0;
+		}
+
+		if (level == g_cells[i])
+		{
+			/* The LCD address counter stays behind, the next written cell has to move the cursor */
+			cursorInPlace = FALSE;
+			g_stats.cellSkips++;
+			continue;
+		}
+
+		if (!cursorInPlace)
+		{
+			LCD_moveCursor (BAR_GRAPH_ROW, BAR_GRAPH_COL + i);
+			cursorInPlace = TRUE;
+		}
+		/* The address counter increments after each data write so a run of changed cells needs one move */
+		LCD_sendData ((level == 0) ? ' ' : (BAR_GRAPH_FIRST_GLYPH + level - 1));
+		g_cells[i] = level;
+		g_stats.cellWrites++;
+	}
+}
+
+/*
+ * Description :
+ * Copy the counters of the written and skipped cells.
+ */
+void BarGraph_getStats (BarGraph_StatsType * Stats_Ptr)
+{
+	*Stats_Ptr = g_stats;
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+ *
+ * Module: BAR_GRAPH
+ *
+ * File Name: bar_graph.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the LCD bar graph of the fan speed, drawn with
+ *              custom CGRAM glyphs at one pixel column resolution.
+ *
+ *******************************************************************************/
+
+#ifndef BAR_GRAPH_H_
+#define BAR_GRAPH_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define BAR_GRAPH_ROW                            3
+#define BAR_GRAPH_COL                            0
+#define BAR_GRAPH_NUM_OF_CELLS                   16
+
+/* First CGRAM location of the glyph set, the glyphs of 1 to 5 filled columns follow it */
+#define BAR_GRAPH_FIRST_GLYPH                    0
+
+/* Parameters Definitions */
+#define BAR_GRAPH_COLUMNS_PER_CELL               5
+#define BAR_GRAPH_NUM_OF_COLUMNS                 (BAR_GRAPH_NUM_OF_CELLS * BAR_GRAPH_COLUMNS_PER_CELL)
+#define BAR_GRAPH_MAX_VALUE                      100
+#define BAR_GRAPH_NOT_DRAWN                      0xFF
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	uint32 cellWrites;                 /* Cells sent to the LCD */
+	uint32 cellSkips;                  /* Cells left untouched as their glyph did not change */
+} BarGraph_StatsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Load the glyph set from the flash memory into the LCD CGRAM, this is the only
+ * CGRAM write of the bar graph so it must be called once after LCD_init.
+ * The whole bar is drawn by the next update.
+ */
+void BarGraph_init (void);
+
+/*
+ * Description :
+ * Incremental form of BarGraph_init for a boot which must not block: every call loads
+ * the next glyph and returns TRUE once the glyph set is loaded and the bar invalidated.
+ */
+bool BarGraph_initStep (void);
+
+/*
+ * Description :
+ * Forget the drawn cells so the next update redraws the whole bar,
+ * used after the bar area of the screen was overwritten or cleared.
+ */
+void BarGraph_invalidate (void);
+
+/*
+ * Description :
+ * Show the given value (0 .. BAR_GRAPH_MAX_VALUE) as a bar of filled pixel columns,
+ * only the cells whose glyph changed since the last update are sent to the LCD.
+ */
+void BarGraph_update (uint8 value);
+
+/*
+ * Description :
+ * Copy the counters of the written and skipped cells.
+ */
+void BarGraph_getStats (BarGraph_StatsType * Stats_Ptr);
+
+#endif /* BAR_GRAPH_H_ */
@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ * Module: BOOT_TIME
+ *
+ * File Name: boot_time.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the measurement of the reset to first PWM time
+ *
+ *******************************************************************************/
+
+#include "boot_time.h"
+#include "timer.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Normal mode counting from zero, no output and no interrupt */
+static const Timer_ConfigType g_timerConfig = {
+	TIMER_NORMAL_MODE, TIMER_PRESCALER_OF (BOOT_TIME_TIMER_PRESCALER), 0, {0, 0},
+	{TIMER_OUTPUT_DISCONNECTED, TIMER_OUTPUT_DISCONNECTED}, 0, TIMER_CAPTURE_FALLING
+};
+
+static uint16 g_firstPwmUs = BOOT_TIME_NOT_MEASURED;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Start the stopwatch from zero on Timer1, called first in main. The C startup
+ * before main (a few hundred cycles) is not counted.
+ */
+void BootTime_start (void)
+{
+	g_firstPwmUs = BOOT_TIME_NOT_MEASURED;
+	Timer_init (TIMER1_ID, &g_timerConfig);
+}
+
+/*
+ * Description :
+ * Latch the stopwatch once the first PWM duty is written, Timer1 is then free
+ * for the deadline monitor. The next calls are ignored.
+ */
+void BootTime_markFirstPwm (void)
+{
+	uint32 elapsed;
+
+	if (g_firstPwmUs != BOOT_TIME_NOT_MEASURED)
+	{
+		return;
+	}
+	elapsed = (uint32)Timer_getCount (TIMER1_ID) * BOOT_TIME_TICK_US;
+	Timer_deinit (TIMER1_ID);
+	g_firstPwmUs = (elapsed >= BOOT_TIME_NOT_MEASURED) ? (BOOT_TIME_NOT_MEASURED - 1) : (uint16)elapsed;
+}
+
+/*
+ * Description :
+ * Return the time from the start of main to the first PWM duty in microseconds,
+ * saturated to 0xFFFE, or BOOT_TIME_NOT_MEASURED before the mark.
+ */
+uint16 BootTime_getFirstPwmUs (void)
+{
+	return g_firstPwmUs;
+}
@@ -0,0 +1,61 @@
+/******************************************************************************
+ *
+ * Module: BOOT_TIME
+ *
+ * File Name: boot_time.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the measurement of the reset to first PWM time
+ *
+ *******************************************************************************/
+
+#ifndef BOOT_TIME_H_
+#define BOOT_TIME_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations, the stopwatch runs on Timer1 before the deadline monitor takes it */
+#define BOOT_TIME_TIMER_PRESCALER                64
+
+/* Parameters Definitions */
+#define BOOT_TIME_TICK_US                        ((BOOT_TIME_TIMER_PRESCALER * 1000000UL) / F_CPU)
+#define BOOT_TIME_NOT_MEASURED                   0xFFFF
+
+#if ((BOOT_TIME_TIMER_PRESCALER != 1) && (BOOT_TIME_TIMER_PRESCALER != 8) && (BOOT_TIME_TIMER_PRESCALER != 64) && \
+		(BOOT_TIME_TIMER_PRESCALER != 256) && (BOOT_TIME_TIMER_PRESCALER != 1024))
+#error "The stopwatch timer prescaler does not exist on Timer1"
+#endif
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Start the stopwatch from zero on Timer1, called first in main. The C startup
+ * before main (a few hundred cycles) is not counted.
+ */
+void BootTime_start (void);
+
+/*
+ * Description :
+ * Latch the stopwatch once the first PWM duty is written, Timer1 is then free
+ * for the deadline monitor. The next calls are ignored.
+ */
+void BootTime_markFirstPwm (void);
+
+/*
+ * Description :
+ * Return the time from the start of main to the first PWM duty in microseconds,
+ * saturated to 0xFFFE, or BOOT_TIME_NOT_MEASURED before the mark.
+ */
+uint16 BootTime_getFirstPwmUs (void);
+
+#endif /* BOOT_TIME_H_ */
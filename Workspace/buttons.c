@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Module: BUTTONS
+ *
+ * File Name: buttons.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the debounced push buttons scanned from the system tick
+ *
+ *******************************************************************************/
+
+#include "buttons.h"
+#include "gpio.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static const uint8 g_pins[BUTTONS_NUM_OF_BUTTONS] = {BUTTONS_NEXT_PIN, BUTTONS_UP_PIN, BUTTONS_DOWN_PIN};
+
+/* Integrating debounce counter of each button, 0 = released and BUTTONS_DEBOUNCE_TICKS = pressed */
+static uint8 g_counters[BUTTONS_NUM_OF_BUTTONS];
+static uint8 g_pressedMask = 0;
+
+/* The tick interrupt pushes the presses and the main loop pops them */
+static uint8 g_queueData[BUTTONS_QUEUE_SIZE];
+static RingBuffer_Type g_queue;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Setup the button pins as inputs with the internal pull-up resistors and
+ * clear the debounce state and the event queue.
+ */
+void Buttons_init (void)
+{
+	uint8 i;
+
+	for (i = 0; i < BUTTONS_NUM_OF_BUTTONS; i++)
+	{
+		GPIO_setupPinDirection (BUTTONS_PORT, g_pins[i], PIN_INPUT);
+		GPIO_writePin (BUTTONS_PORT, g_pins[i], LOGIC_HIGH);    /* Enable the internal pull-up */
+		g_counters[i] = 0;
+	}
+	g_pressedMask = 0;
+	RingBuffer_init (&g_queue, g_queueData, BUTTONS_QUEUE_SIZE);
+}
+
+/*
+ * Description :
+ * Sample all the buttons once, called every system tick from the tick interrupt.
+ * A button press is queued once its pin stayed low for BUTTONS_DEBOUNCE_TICKS samples.
+ */
+void Buttons_scan (void)
+{
+	uint8 i;
+
+	for (i = 0; i < BUTTONS_NUM_OF_BUTTONS; i++)
+	{
+		/* Count towards the sampled level, a bounce only moves the counter back and forth */
+		if (GPIO_readPin (BUTTONS_PORT, g_pins[i]) == LOGIC_LOW)
+		{
+			if (g_counters[i] < BUTTONS_DEBOUNCE_TICKS)
+			{
+				g_counters[i]++;
+			}
+		}
+		else if (g_counters[i] > 0)
+		{
+			g_counters[i]--;
+		}
+
+		/* The state only changes at the ends of the counter range */
+		if ((g_counters[i] == BUTTONS_DEBOUNCE_TICKS) && !(g_pressedMask & (1 << i)))
+		{
+			g_pressedMask |= (uint8)(1 << i);
+			RingBuffer_push (&g_queue, i);   /* A full queue keeps the older presses */
+		}
+		else if ((g_counters[i] == 0) && (g_pressedMask & (1 << i)))
+		{
+			g_pressedMask &= (uint8)(~(1 << i));
+		}
+	}
+}
+
+/*
+ * Description :
+ * Take the oldest button press from the queue.
+ * Returns FALSE if no press is waiting.
+ */
+bool Buttons_getEvent (Buttons_IdType * Button_Ptr)
+{
+	uint8 button;
+
+	if (!RingBuffer_pop (&g_queue, &button))
+	{
+		return FALSE;
+	}
+	*Button_Ptr = (Buttons_IdType)button;
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Return the number of presses lost because the queue was full.
+ */
+uint16 Buttons_getDroppedEvents (void)
+{
+	return RingBuffer_getOverflows (&g_queue);
+}
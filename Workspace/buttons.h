@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ * Module: BUTTONS
+ *
+ * File Name: buttons.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the debounced push buttons scanned from the system tick
+ *
+ *******************************************************************************/
+
+#ifndef BUTTONS_H_
+#define BUTTONS_H_
+
+#include "std_types.h"
+#include "ring_buffer.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations, the buttons connect the pins to ground (internal pull-ups) */
+#define BUTTONS_PORT                             PORTA_ID
+#define BUTTONS_NEXT_PIN                         PIN5_ID
+#define BUTTONS_UP_PIN                           PIN6_ID
+#define BUTTONS_DOWN_PIN                         PIN7_ID
+
+/* Consecutive equal samples (system ticks) needed to accept a new button state */
+#define BUTTONS_DEBOUNCE_TICKS                   3
+
+/* Events waiting for the main loop, must be a power of two */
+#define BUTTONS_QUEUE_SIZE                       8
+
+#if (!RING_BUFFER_SIZE_IS_VALID (BUTTONS_QUEUE_SIZE))
+#error "The button queue size must be a power of two from 2 to RING_BUFFER_MAX_SIZE"
+#endif
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	BUTTON_NEXT, BUTTON_UP, BUTTON_DOWN, BUTTONS_NUM_OF_BUTTONS
+} Buttons_IdType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Setup the button pins as inputs with the internal pull-up resistors and
+ * clear the debounce state and the event queue.
+ */
+void Buttons_init (void);
+
+/*
+ * Description :
+ * Sample all the buttons once, called every system tick from the tick interrupt.
+ * A button press is queued once its pin stayed low for BUTTONS_DEBOUNCE_TICKS samples.
+ */
+void Buttons_scan (void);
+
+/*
+ * Description :
+ * Take the oldest button press from the queue.
+ * Returns FALSE if no press is waiting.
+ */
+bool Buttons_getEvent (Buttons_IdType * Button_Ptr);
+
+/*
+ * Description :
+ * Return the number of presses lost because the queue was full.
+ */
+uint16 Buttons_getDroppedEvents (void);
+
+#endif /* BUTTONS_H_ */
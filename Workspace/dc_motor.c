@@ -12,9 +12,30 @@
  *
  *******************************************************************************/
 
-#include "DC_motor.h"
+#include "dc_motor.h"
 #include "gpio.h"
 #include "pwm_timer0.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* Set the out put of the two motor pins to change its rotation direction depending on the input */
+static void DcMotor_setDirection (DcMotor_Direction dir)
+{
+	if (dir == CW)
+	{
+		GPIO_writePin (DC_PORT, DC_IN1_PIN, LOGIC_LOW);
+		GPIO_writePin (DC_PORT, DC_IN2_PIN, LOGIC_HIGH);
+	}
+
+	else if (dir == CCW)
+	{
+		GPIO_writePin (DC_PORT, DC_IN1_PIN, LOGIC_HIGH);
+		GPIO_writePin (DC_PORT, DC_IN2_PIN, LOGIC_LOW);
+	}
+}
 
 /*******************************************************************************
  *                          Functions Definitions                              *
@@ -44,24 +65,27 @@ void DcMotor_init (void)
  */
 void DcMotor_rotate (DcMotor_Direction dir, uint8 speed)
 {
-	uint8 dutyCycle = 0;
+	DcMotor_setDirection (dir);
 
-	/* Set the out put of the two motor pins to change its rotation direction depending on the input */
-	if (dir == CW)
-	{
-		GPIO_writePin (DC_PORT, DC_IN1_PIN, LOGIC_LOW);
-		GPIO_writePin (DC_PORT, DC_IN2_PIN, LOGIC_HIGH);
-	}
+	/* The speed in percent is the duty cycle in percent */
+	PWM_Timer0_start ((speed > DC_MAX_SPEED) ? DC_MAX_SPEED : speed);
+}
 
-	else if (dir == CCW)
+/*
+ * Description :
+ * Same as DcMotor_rotate with the speed in 1/256 percent (Q8.8), 0 to DC_FINE_MAX_SPEED,
+ * for the low speeds which need more than whole percent steps of the dithered PWM.
+ */
+void DcMotor_rotateFine (DcMotor_Direction dir, uint16 speed)
+{
+	DcMotor_setDirection (dir);
+
+	/* The equation to transform the speed into the fine duty and send to the timer driver */
+	if (speed > DC_FINE_MAX_SPEED)
 	{
-		GPIO_writePin (DC_PORT, DC_IN1_PIN, LOGIC_HIGH);
-		GPIO_writePin (DC_PORT, DC_IN2_PIN, LOGIC_LOW);
+		speed = DC_FINE_MAX_SPEED;
 	}
-
-	/* The equation to transform the speed into duty cycle and send to the timer driver */
-	dutyCycle = (uint8)(((float32)speed / DC_MAX_SPEED) * 100);
-	PWM_Timer0_start (dutyCycle);
+	PWM_Timer0_setDuty ((uint16)Fixed_scaleRound (speed, PWM_TIMER0_DUTY_MAX, DC_FINE_MAX_SPEED));
 }
 
 /*
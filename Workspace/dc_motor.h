@@ -30,6 +30,7 @@
 #define DC_MAX_SPEED      100
 #define DC_MIN_SPEED      0
 #define DC_FREQUENCY      500
+#define DC_FINE_MAX_SPEED ((uint16)DC_MAX_SPEED << 8)        /* 100 % in 1/256 percent */
 
 /*******************************************************************************
  *                               Enumerations                                  *
@@ -58,6 +59,13 @@ void DcMotor_init (void);
  */
 void DcMotor_rotate (DcMotor_Direction dir, uint8 speed);
 
+/*
+ * Description :
+ * Same as DcMotor_rotate with the speed in 1/256 percent (Q8.8), 0 to DC_FINE_MAX_SPEED,
+ * for the low speeds which need more than whole percent steps of the dithered PWM.
+ */
+void DcMotor_rotateFine (DcMotor_Direction dir, uint16 speed);
+
 /*
  * Description :
  * 1. The Function responsible for stop the motor rotation by stoping the two motor pins.
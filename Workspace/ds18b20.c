@@ -0,0 +1,224 @@
+/******************************************************************************
+ *
+ * Module: DS18B20
+ *
+ * File Name: ds18b20.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the DS18B20 digital temperature sensor driver,
+ *              a state machine advanced by one short bus operation per call so
+ *              the 750 ms conversion never blocks the control loop.
+ *
+ *******************************************************************************/
+
+#include "ds18b20.h"
+#include "one_wire.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	DS18B20_STATE_IDLE, DS18B20_STATE_CONVERT_RESET, DS18B20_STATE_CONVERT_ROM, DS18B20_STATE_CONVERT_COMMAND,
+	DS18B20_STATE_WAIT, DS18B20_STATE_READ_RESET, DS18B20_STATE_READ_ROM, DS18B20_STATE_READ_COMMAND,
+	DS18B20_STATE_READ_SCRATCHPAD
+} DS18B20_StateType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static DS18B20_StateType g_state = DS18B20_STATE_IDLE;
+static DS18B20_StatusType g_status = DS18B20_STATUS_NO_DATA;
+static sint16 g_temperature = 0;
+
+static uint32 g_nextStartTick = 0;
+static uint32 g_readyTick = 0;
+
+static uint8 g_scratchpad[DS18B20_SCRATCHPAD_SIZE];
+static uint8 g_index = 0;
+static uint8 g_crc = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static bool DS18B20_isDue (uint32 tick)
+{
+	return ((sint32)(SysTick_getTicks () - tick) >= 0) ? TRUE : FALSE;
+}
+
+/* End of a measurement, successful or not, the next one starts one period after this one */
+static void DS18B20_finish (DS18B20_StatusType status)
+{
+	g_status = status;
+	g_state = DS18B20_STATE_IDLE;
+}
+
+static void DS18B20_checkScratchpad (void)
+{
+	/* The CRC of the whole scratchpad including its CRC byte is zero */
+	if (g_crc != 0)
+	{
+		DS18B20_finish (DS18B20_STATUS_CRC_ERROR);
+		return;
+	}
+	/* The sensor gives 1/16 C steps, Q8.8 has 1/256 C steps */
+	g_temperature = (sint16)(((uint16)g_scratchpad[1] << 8) | g_scratchpad[0]) * 16;
+	DS18B20_finish (DS18B20_STATUS_OK);
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Release the bus and start the first conversion on the next step.
+ */
+void DS18B20_init (void)
+{
+	OneWire_init ();
+	g_state = DS18B20_STATE_IDLE;
+	g_status = DS18B20_STATUS_NO_DATA;
+	g_nextStartTick = SysTick_getTicks ();
+}
+
+/*
+ * Description :
+ * Advance the measurement by one bus operation (reset, command byte or scratchpad
+ * byte), about 1 ms at most. Called every loop iteration.
+ */
+void DS18B20_step (void)
+{
+	uint8 i;
+
+	switch (g_state)
+	{
+	case DS18B20_STATE_IDLE:
+		if (DS18B20_isDue (g_nextStartTick))
+		{
+			g_nextStartTick += SYS_TICK_MS_TO_TICKS (DS18B20_PERIOD_MS);
+			g_state = DS18B20_STATE_CONVERT_RESET;
+		}
+		break;
+
+	case DS18B20_STATE_CONVERT_RESET:
+		if (OneWire_reset ())
+		{
+			g_state = DS18B20_STATE_CONVERT_ROM;
+		}
+		else
+		{
+			DS18B20_finish (DS18B20_STATUS_NO_DEVICE);
+		}
+		break;
+
+	case DS18B20_STATE_CONVERT_ROM:
+		OneWire_writeByte (ONE_WIRE_SKIP_ROM);
+		g_state = DS18B20_STATE_CONVERT_COMMAND;
+		break;
+
+	case DS18B20_STATE_CONVERT_COMMAND:
+		OneWire_writeByte (DS18B20_CONVERT_T);
+		/* One extra tick as the current one is already partly elapsed */
+		g_readyTick = SysTick_getTicks () + SYS_TICK_MS_TO_TICKS (DS18B20_CONVERSION_MS) + 1;
+		g_state = DS18B20_STATE_WAIT;
+		break;
+
+	case DS18B20_STATE_WAIT:
+		if (DS18B20_isDue (g_readyTick))
+		{
+			g_state = DS18B20_STATE_READ_RESET;
+		}
+		break;
+
+	case DS18B20_STATE_READ_RESET:
+		if (OneWire_reset ())
+		{
+			g_state = DS18B20_STATE_READ_ROM;
+		}
+		else
+		{
+			DS18B20_finish (DS18B20_STATUS_NO_DEVICE);
+		}
+		break;
+
+	case DS18B20_STATE_READ_ROM:
+		OneWire_writeByte (ONE_WIRE_SKIP_ROM);
+		g_state = DS18B20_STATE_READ_COMMAND;
+		break;
+
+	case DS18B20_STATE_READ_COMMAND:
+		OneWire_writeByte (DS18B20_READ_SCRATCHPAD);
+		g_index = 0;
+		g_crc = 0;
+		g_state = DS18B20_STATE_READ_SCRATCHPAD;
+		break;
+
+	case DS18B20_STATE_READ_SCRATCHPAD:
+		for (i = 0; (i < DS18B20_BYTES_PER_STEP) && (g_index < DS18B20_SCRATCHPAD_SIZE); i++)
+		{
+			g_scratchpad[g_index] = OneWire_readByte ();
+			g_crc = OneWire_crc8 (g_crc, g_scratchpad[g_index]);
+			g_index++;
+		}
+		if (g_index == DS18B20_SCRATCHPAD_SIZE)
+		{
+			DS18B20_checkScratchpad ();
+		}
+		break;
+	}
+}
+
+/*
+ * Description :
+ * Copy the last valid temperature in Q8.8 C.
+ * Returns the status of the last measurement.
+ */
+DS18B20_StatusType DS18B20_getTemperature (sint16 * Temperature_Ptr)
+{
+	*Temperature_Ptr = g_temperature;
+	return g_status;
+}
+
+/*******************************************************************************
+ *                      Sensor Interface Definitions                           *
+ *******************************************************************************/
+static void DS18B20_sensorInit (uint8 channel)
+{
+	(void)channel;
+	DS18B20_init ();
+}
+
+static sint16 DS18B20_sensorRead (uint8 channel)
+{
+	(void)channel;
+	return g_temperature;
+}
+
+/* The raw reading is already Q8.8 C */
+static sint16 DS18B20_sensorConvert (sint16 raw)
+{
+	return raw;
+}
+
+static Sensor_StatusType DS18B20_sensorStatus (uint8 channel)
+{
+	(void)channel;
+	switch (g_status)
+	{
+	case DS18B20_STATUS_OK:
+		return SENSOR_STATUS_OK;
+	case DS18B20_STATUS_NO_DATA:
+		return SENSOR_STATUS_NO_DATA;
+	default:
+		return SENSOR_STATUS_FAULT;
+	}
+}
+
+const Sensor_InterfaceType DS18B20_sensorInterface = {
+	DS18B20_sensorInit, DS18B20_step, DS18B20_sensorRead, DS18B20_sensorConvert, DS18B20_sensorStatus
+};
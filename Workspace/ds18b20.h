@@ -0,0 +1,76 @@
+/******************************************************************************
+ *
+ * Module: DS18B20
+ *
+ * File Name: ds18b20.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the DS18B20 digital temperature sensor driver,
+ *              a state machine advanced by one short bus operation per call so
+ *              the 750 ms conversion never blocks the control loop.
+ *
+ *******************************************************************************/
+
+#ifndef DS18B20_H_
+#define DS18B20_H_
+
+#include "std_types.h"
+#include "sensor.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations, a single externally powered sensor on the bus (Skip ROM) */
+#define DS18B20_PERIOD_MS                        1000
+#define DS18B20_CONVERSION_MS                    750      /* 12-bit resolution */
+#define DS18B20_BYTES_PER_STEP                   1        /* About 0.55 ms of bus time per byte */
+
+/* Function commands */
+#define DS18B20_CONVERT_T                        0x44
+#define DS18B20_READ_SCRATCHPAD                  0xBE
+#define DS18B20_SCRATCHPAD_SIZE                  9
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	DS18B20_STATUS_NO_DATA, DS18B20_STATUS_OK, DS18B20_STATUS_NO_DEVICE, DS18B20_STATUS_CRC_ERROR
+} DS18B20_StatusType;
+
+/*******************************************************************************
+ *                           External Variables                                *
+ *******************************************************************************/
+
+/* Sensor interface of the DS18B20, the raw reading is the last valid temperature in Q8.8 C */
+extern const Sensor_InterfaceType DS18B20_sensorInterface;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Release the bus and start the first conversion on the next step.
+ */
+void DS18B20_init (void);
+
+/*
+ * Description :
+ * Advance the measurement by one bus operation (reset, command byte or scratchpad
+ * byte), about 1 ms at most. Called every loop iteration.
+ */
+void DS18B20_step (void);
+
+/*
+ * Description :
+ * Copy the last valid temperature in Q8.8 C.
+ * Returns the status of the last measurement.
+ */
+DS18B20_StatusType DS18B20_getTemperature (sint16 * Temperature_Ptr);
+
+#endif /* DS18B20_H_ */
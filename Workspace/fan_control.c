@@ -0,0 +1,314 @@
+/******************************************************************************
+ *
+ * Module: FAN_CONTROL
+ *
+ * File Name: fan_control.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the temperature to fan speed control policy
+ *
+ *******************************************************************************/
+
+#include "fan_control.h"
+#include "dc_motor.h"
+#include "pid_controller.h"
+#include "slope_estimator.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static const FanControl_CurveType g_curve = {FAN_CURVE_THRESHOLDS, FAN_CURVE_SPEEDS};
+
+static uint8 g_appliedSpeed = FAN_CONTROL_NO_SPEED;
+static uint8 g_minSpeed = DC_MIN_SPEED;
+static FanControl_StatsType g_stats = {0, 0};
+
+static Slope_EstimatorType g_slope;
+static uint32 g_nextSampleTick = 0;
+static bool g_feedForwardEnabled = FAN_FEEDFORWARD;
+static uint8 g_feedForward = 0;
+
+/* Gains and setpoint of fan_curve.h until a tuning, the stored gains or the user replace them */
+static Pid_GainsType g_pidGains = {FAN_PID_KP, FAN_PID_KI, FAN_PID_KD};
+static uint8 g_setpoint = FAN_PID_SETPOINT;
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+static Pid_ControllerType g_pid;
+static uint32 g_nextPidTick = 0;
+static uint8 g_pidSpeed = 0;
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * Sample the temperature every FAN_FEEDFORWARD_PERIOD_MS and turn the least-squares
+ * slope of the window into a speed term, so the fan spins up while the temperature
+ * is still climbing towards the next threshold instead of after crossing it.
+ * A falling temperature gives no term, the policy alone slows the fan down.
+ * The window is kept while the term is disabled, so enabling it acts at once.
+ */
+static void FanControl_updateFeedForward (uint8 temperature)
+{
+	sint32 term;
+
+	if ((sint32)(SysTick_getTicks () - g_nextSampleTick) < 0)
+	{
+		return;
+	}
+	g_nextSampleTick += SYS_TICK_MS_TO_TICKS (FAN_FEEDFORWARD_PERIOD_MS);
+	if ((sint32)(SysTick_getTicks () - g_nextSampleTick) >= 0)
+	{
+		/* The updates were suspended (e.g. by an auto-tuning), restart the sampling from now */
+		g_nextSampleTick = SysTick_getTicks () + SYS_TICK_MS_TO_TICKS (FAN_FEEDFORWARD_PERIOD_MS);
+	}
+	Slope_addSample (&g_slope, temperature);
+
+	/* Q8.8 Celsius per sample period to percent of speed */
+	term = Slope_get (&g_slope);
+	if ((!g_feedForwardEnabled) || (term <= 0))
+	{
+		g_feedForward = 0;
+		return;
+	}
+	term = (term * (60000L / FAN_FEEDFORWARD_PERIOD_MS) * FAN_FEEDFORWARD_GAIN) >> SLOPE_FRACTION_BITS;
+	g_feedForward = (term > FAN_FEEDFORWARD_MAX) ? FAN_FEEDFORWARD_MAX : (uint8)term;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clear the history of the configured control policy (PID integral and last error)
+ * and forget the applied speed so the next update always drives the motor.
+ */
+void FanControl_init (void)
+{
+	g_appliedSpeed = FAN_CONTROL_NO_SPEED;
+	g_stats.actuatorWrites = 0;
+	g_stats.actuatorSkips = 0;
+	g_feedForward = 0;
+
+	Slope_init (&g_slope);
+	g_nextSampleTick = SysTick_getTicks ();
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	Pid_init (&g_pid, &g_pidGains, g_setpoint);
+	g_nextPidTick = SysTick_getTicks ();
+#endif
+}
+
+/*
+ * Description :
+ * Return the fan speed in percent for the given temperature from the given curve,
+ * the speed of the highest threshold reached or zero below the first one.
+ */
+uint8 FanControl_getCurveSpeed (const FanControl_CurveType * Curve_Ptr, uint8 temperature)
+{
+	uint8 i = FAN_CURVE_NUM_OF_POINTS;
+
+	/* Search from the hottest point down for the first threshold reached */
+	while (i > 0)
+	{
+		i--;
+		if (temperature >= Curve_Ptr -> thresholds[i])
+		{
+			return Curve_Ptr -> speeds[i];
+		}
+	}
+	return DC_MIN_SPEED;
+}
+
+/*
+ * Description :
+ * Return the fan speed in percent for the given temperature from the configured
+ * policy: the fan curve of fan_curve.h or the PID controller around its setpoint,
+ * updated every PID_PERIOD_MS whatever the loop period and held in between.
+ */
+uint8 FanControl_getSpeed (uint8 temperature)
+{
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	if ((sint32)(SysTick_getTicks () - g_nextPidTick) >= 0)
+	{
+		g_nextPidTick += SYS_TICK_MS_TO_TICKS (PID_PERIOD_MS);
+		if ((sint32)(SysTick_getTicks () - g_nextPidTick) >= 0)
+		{
+			/* The updates were suspended (e.g. by an auto-tuning), restart the period from now */
+			g_nextPidTick = SysTick_getTicks () + SYS_TICK_MS_TO_TICKS (PID_PERIOD_MS);
+		}
+		g_pidSpeed = Pid_update (&g_pid, (sint16)temperature);
+	}
+	return g_pidSpeed;
+#else
+	return FanControl_getCurveSpeed (&g_curve, temperature);
+#endif
+}
+
+/*
+ * Description :
+ * 1. Get the required fan speed for the given temperature, plus the feed-forward term
+ *    of the temperature rise while it is enabled, not below the user minimum.
+ * 2. If it differs from the applied one, rotate the fan with this speed or stop it
+ *    if the speed is zero, otherwise leave the PWM and the motor pins untouched.
+ * Returns the applied speed in percent.
+ */
+uint8 FanControl_update (uint8 temperature)
+{
+	uint8 speed = FanControl_getSpeed (temperature);
+
+	FanControl_updateFeedForward (temperature);
+	speed = (speed + g_feedForward > DC_MAX_SPEED) ? DC_MAX_SPEED : (speed + g_feedForward);
+
+	/* The user floor can only make the fan faster than the policy asks */
+	if (speed < g_minSpeed)
+	{
+		speed = g_minSpeed;
+	}
+
+	return FanControl_apply (speed);
+}
+
+/*
+ * Description :
+ * Drive the motor with the given speed in percent if it differs from the applied one,
+ * rotate the fan or stop it if the speed is zero, otherwise leave the PWM and the
+ * motor pins untouched. Returns the applied speed.
+ */
+uint8 FanControl_apply (uint8 speed)
+{
+	/* Rewriting the same duty and motor pins is wasted work, so only changes reach the motor */
+	if (speed == g_appliedSpeed)
+	{
+		g_stats.actuatorSkips++;
+		return speed;
+	}
+	g_appliedSpeed = speed;
+	g_stats.actuatorWrites++;
+
+	if (speed > DC_MIN_SPEED)
+	{
+		DcMotor_rotate (CW, speed);
+	}
+	else
+	{
+		DcMotor_stop ();
+	}
+	return speed;
+}
+
+/*
+ * Description :
+ * Return the speed in percent applied to the motor by the last update, zero before the first one.
+ */
+uint8 FanControl_getAppliedSpeed (void)
+{
+	return (g_appliedSpeed == FAN_CONTROL_NO_SPEED) ? DC_MIN_SPEED : g_appliedSpeed;
+}
+
+/*
+ * Description :
+ * Set the lowest speed in percent applied whatever the temperature, zero to follow the policy only.
+ */
+void FanControl_setMinSpeed (uint8 speed)
+{
+	g_minSpeed = (speed > DC_MAX_SPEED) ? DC_MAX_SPEED : speed;
+}
+
+/*
+ * Description :
+ * Return the lowest speed in percent set by the user.
+ */
+uint8 FanControl_getMinSpeed (void)
+{
+	return g_minSpeed;
+}
+
+/*
+ * Description :
+ * Replace the gains of the PID mode (e.g. with tuned ones) and restart the controller.
+ */
+void FanControl_setPidGains (const Pid_GainsType * Gains_Ptr)
+{
+	g_pidGains = *Gains_Ptr;
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	Pid_init (&g_pid, &g_pidGains, g_setpoint);
+	g_nextPidTick = SysTick_getTicks ();
+#endif
+}
+
+/*
+ * Description :
+ * Copy the gains used by the PID mode.
+ */
+void FanControl_getPidGains (Pid_GainsType * Gains_Ptr)
+{
+	*Gains_Ptr = g_pidGains;
+}
+
+/*
+ * Description :
+ * Set the temperature in Celsius regulated by the PID mode and the auto-tuning,
+ * the controller restarts around it.
+ */
+void FanControl_setSetpoint (uint8 setpoint)
+{
+	g_setpoint = setpoint;
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	Pid_init (&g_pid, &g_pidGains, g_setpoint);
+	g_nextPidTick = SysTick_getTicks ();
+#endif
+}
+
+/*
+ * Description :
+ * Return the temperature in Celsius regulated by the PID mode and the auto-tuning.
+ */
+uint8 FanControl_getSetpoint (void)
+{
+	return g_setpoint;
+}
+
+/*
+ * Description :
+ * Enable or disable the feed-forward term at run time, FAN_FEEDFORWARD selects it at boot.
+ */
+void FanControl_setFeedForward (bool enable)
+{
+	g_feedForwardEnabled = enable;
+	if (!enable)
+	{
+		g_feedForward = 0;
+	}
+}
+
+/*
+ * Description :
+ * Return TRUE if the feed-forward term is enabled.
+ */
+bool FanControl_getFeedForwardEnable (void)
+{
+	return g_feedForwardEnabled;
+}
+
+/*
+ * Description :
+ * Return the feed-forward term in percent added to the policy speed by the last update.
+ */
+uint8 FanControl_getFeedForward (void)
+{
+	return g_feedForward;
+}
+
+/*
+ * Description :
+ * Copy the counters of the written and skipped actuator updates.
+ */
+void FanControl_getStats (FanControl_StatsType * Stats_Ptr)
+{
+	*Stats_Ptr = g_stats;
+}
@@ -0,0 +1,164 @@
+/******************************************************************************
+ *
+ * Module: FAN_CONTROL
+ *
+ * File Name: fan_control.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the temperature to fan speed control policy
+ *
+ *******************************************************************************/
+
+#ifndef FAN_CONTROL_H_
+#define FAN_CONTROL_H_
+
+#include "std_types.h"
+#include "pid_controller.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define FAN_FEEDFORWARD                          0          /* 1 to add the temperature slope term to the policy speed from boot, costs fan energy */
+#define FAN_FEEDFORWARD_PERIOD_MS                1000       /* Sample period of the slope estimator */
+#define FAN_FEEDFORWARD_GAIN                     10         /* Percent of speed per Celsius/minute of rise */
+#define FAN_FEEDFORWARD_MAX                      50         /* Highest feed-forward term in percent */
+
+/* Parameters Definitions */
+#define FAN_CONTROL_MODE_CURVE                   0
+#define FAN_CONTROL_MODE_PID                     1
+#define FAN_CONTROL_NO_SPEED                     0xFF
+
+#include "fan_curve.h"
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/* Temperature thresholds in Celsius (ascending) and the fan speed in percent from each one */
+typedef struct{
+	uint8 thresholds[FAN_CURVE_NUM_OF_POINTS];
+	uint8 speeds[FAN_CURVE_NUM_OF_POINTS];
+} FanControl_CurveType;
+
+typedef struct{
+	uint32 actuatorWrites;             /* Updates which changed the PWM duty */
+	uint32 actuatorSkips;              /* Updates which left the PWM untouched as the duty did not change */
+} FanControl_StatsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clear the history of the configured control policy (PID integral and last error)
+ * and forget the applied speed so the next update always drives the motor.
+ */
+void FanControl_init (void);
+
+/*
+ * Description :
+ * Return the fan speed in percent for the given temperature from the given curve,
+ * the speed of the highest threshold reached or zero below the first one.
+ */
+uint8 FanControl_getCurveSpeed (const FanControl_CurveType * Curve_Ptr, uint8 temperature);
+
+/*
+ * Description :
+ * Return the fan speed in percent for the given temperature from the configured
+ * policy: the fan curve of fan_curve.h or the PID controller around its setpoint,
+ * updated every PID_PERIOD_MS whatever the loop period and held in between.
+ */
+uint8 FanControl_getSpeed (uint8 temperature);
+
+/*
+ * Description :
+ * 1. Get the required fan speed for the given temperature, plus the feed-forward term
+ *    of the temperature rise while it is enabled, not below the user minimum.
+ * 2. If it differs from the applied one, rotate the fan with this speed or stop it
+ *    if the speed is zero, otherwise leave the PWM and the motor pins untouched.
+ * Returns the applied speed in percent.
+ */
+uint8 FanControl_update (uint8 temperature);
+
+/*
+ * Description :
+ * Drive the motor with the given speed in percent if it differs from the applied one,
+ * rotate the fan or stop it if the speed is zero, otherwise leave the PWM and the
+ * motor pins untouched. Returns the applied speed.
+ */
+uint8 FanControl_apply (uint8 speed);
+
+/*
+ * Description :
+ * Return the speed in percent applied to the motor by the last update, zero before the first one.
+ */
+uint8 FanControl_getAppliedSpeed (void);
+
+/*
+ * Description :
+ * Set the lowest speed in percent applied whatever the temperature, zero to follow the policy only.
+ */
+void FanControl_setMinSpeed (uint8 speed);
+
+/*
+ * Description :
+ * Return the lowest speed in percent set by the user.
+ */
+uint8 FanControl_getMinSpeed (void);
+
+/*
+ * Description :
+ * Replace the gains of the PID mode (e.g. with tuned ones) and restart the controller.
+ */
+void FanControl_setPidGains (const Pid_GainsType * Gains_Ptr);
+
+/*
+ * Description :
+ * Copy the gains used by the PID mode.
+ */
+void FanControl_getPidGains (Pid_GainsType * Gains_Ptr);
+
+/*
+ * Description :
+ * Set the temperature in Celsius regulated by the PID mode and the auto-tuning,
+ * the controller restarts around it.
+ */
+void FanControl_setSetpoint (uint8 setpoint);
+
+/*
+ * Description :
+ * Return the temperature in Celsius regulated by the PID mode and the auto-tuning.
+ */
+uint8 FanControl_getSetpoint (void);
+
+/*
+ * Description :
+ * Enable or disable the feed-forward term at run time, FAN_FEEDFORWARD selects it at boot.
+ */
+void FanControl_setFeedForward (bool enable);
+
+/*
+ * Description :
+ * Return TRUE if the feed-forward term is enabled.
+ */
+bool FanControl_getFeedForwardEnable (void);
+
+/*
+ * Description :
+ * Return the feed-forward term in percent added to the policy speed by the last update.
+ */
+uint8 FanControl_getFeedForward (void);
+
+/*
+ * Description :
+ * Copy the counters of the written and skipped actuator updates.
+ */
+void FanControl_getStats (FanControl_StatsType * Stats_Ptr);
+
+#endif /* FAN_CONTROL_H_ */
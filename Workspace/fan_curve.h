@@ -0,0 +1,39 @@
+/******************************************************************************
+ *
+ * Module: FAN_CONTROL
+ *
+ * File Name: fan_curve.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Static configuration of the fan curve used by the fan control module,
+ *              it can be regenerated from a parameter sweep by Host/fan_sweep
+ *
+ *******************************************************************************/
+
+#ifndef FAN_CURVE_H_
+#define FAN_CURVE_H_
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define FAN_CURVE_NUM_OF_POINTS                  4
+
+/* Temperature thresholds in Celsius (ascending) and the fan speed in percent from each one */
+#define FAN_CURVE_THRESHOLDS                     {30, 60, 90, 120}
+#define FAN_CURVE_SPEEDS                         {25, 50, 75, 100}
+
+/* FAN_CONTROL_MODE_CURVE follows the fan curve, FAN_CONTROL_MODE_PID regulates around the setpoint */
+#define FAN_CONTROL_MODE                         FAN_CONTROL_MODE_CURVE
+
+/* Setpoint in Celsius and Q16.16 gains per PID_PERIOD_MS update of the PID mode */
+#define FAN_PID_SETPOINT                         55
+#define FAN_PID_KP                               PID_GAIN(4.0)
+#define FAN_PID_KI                               PID_GAIN(0.001)
+#define FAN_PID_KD                               PID_GAIN(0.0)
+
+#endif /* FAN_CURVE_H_ */
@@ -0,0 +1,160 @@
+/******************************************************************************
+ *
+ * Module: FIXED
+ *
+ * File Name: fixed_point.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the Q8.8 / Q16.16 fixed point helpers shared by
+ *              the drivers, so no float or libm routine is linked in the firmware
+ *
+ *******************************************************************************/
+
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clamp a 32-bit intermediate result to the sint16 range of a Q8.8 value.
+ */
+sint16 Fixed_saturate16 (sint32 value)
+{
+	if (value > FIXED_Q8_8_MAX)
+	{
+		return FIXED_Q8_8_MAX;
+	}
+	if (value < FIXED_Q8_8_MIN)
+	{
+		return FIXED_Q8_8_MIN;
+	}
+	return (sint16)value;
+}
+
+/*
+ * Description :
+ * Return a + b of two Q8.8 values, saturated instead of wrapping.
+ */
+sint16 Fixed_addQ8_8 (sint16 a, sint16 b)
+{
+	return Fixed_saturate16 ((sint32)a + b);
+}
+
+/*
+ * Description :
+ * Return a * b of two Q8.8 values rounded to the nearest Q8.8 step and saturated.
+ */
+sint16 Fixed_mulQ8_8 (sint16 a, sint16 b)
+{
+	return Fixed_saturate16 (Fixed_mulShift (a, b, FIXED_Q8_8_SHIFT));
+}
+
+/*
+ * Description :
+ * Return a + b of two Q16.16 values, saturated instead of wrapping.
+ */
+sint32 Fixed_addQ16_16 (sint32 a, sint32 b)
+{
+	/* Only operands of the same sign can overflow */
+	if ((b > 0) && (a > FIXED_Q16_16_MAX - b))
+	{
+		return FIXED_Q16_16_MAX;
+	}
+	if ((b < 0) && (a < FIXED_Q16_16_MIN - b))
+	{
+		return FIXED_Q16_16_MIN;
+	}
+	return a + b;
+}
+
+/*
+ * Description :
+ * Return value * factor with the factor holding the given number of fraction bits
+ * (e.g. a Q4.12 or Q2.14 gain), rounded to the nearest integer. The product must fit
+ * in 32 bits.
+ */
+sint32 Fixed_mulShift (sint32 value, sint32 factor, uint8 shift)
+{
+	return Fixed_round (value * factor, shift);
+}
+
+/*
+ * Description :
+ * Return the fixed point value with the given number of fraction bits rounded to
+ * the nearest integer, halves away from zero.
+ */
+sint32 Fixed_round (sint32 value, uint8 shift)
+{
+	sint32 half = (shift > 0) ? ((sint32)1 << (shift - 1)) : 0;
+
+	/* Work on the magnitude so negative values round like positive ones */
+	if (value < 0)
+	{
+		return -(sint32)((((uint32)0 - (uint32)value) + half) >> shift);
+	}
+	return (sint32)(((uint32)value + half) >> shift);
+}
+
+/*
+ * Description :
+ * Return value * numerator / denominator rounded down, e.g. to turn a percent
+ * into a timer compare value. value * numerator must fit in 32 bits.
+ */
+uint32 Fixed_scale (uint32 value, uint32 numerator, uint32 denominator)
+{
+	return (value * numerator) / denominator;
+}
+
+/*
+ * Description :
+ * Same as Fixed_scale but rounded up.
+ */
+uint32 Fixed_scaleCeil (uint32 value, uint32 numerator, uint32 denominator)
+{
+	return ((value * numerator) + (denominator - 1)) / denominator;
+}
+
+/*
+ * Description :
+ * Same as Fixed_scale but rounded to the nearest integer.
+ */
+uint32 Fixed_scaleRound (uint32 value, uint32 numerator, uint32 denominator)
+{
+	return ((value * numerator) + (denominator / 2)) / denominator;
+}
+
+/*
+ * Description :
+ * Return the square root of the value rounded down, with shifts and adds only.
+ * A Q(2n) value gives a Qn root, e.g. the root of a Q16.16 variance is Q8.8.
+ */
+uint16 Fixed_sqrt (uint32 value)
+{
+	uint32 root = 0;
+	uint32 bit = (uint32)1 << 30;
+
+	/* One result bit per iteration, from the highest power of four not above the value */
+	while (bit > value)
+	{
+		bit >>= 2;
+	}
+	while (bit != 0)
+	{
+		if (value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (uint16)root;
+}
@@ -0,0 +1,112 @@
+/******************************************************************************
+ *
+ * Module: FIXED
+ *
+ * File Name: fixed_point.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the Q8.8 / Q16.16 fixed point helpers shared by
+ *              the drivers, so no float or libm routine is linked in the firmware
+ *
+ *******************************************************************************/
+
+#ifndef FIXED_POINT_H_
+#define FIXED_POINT_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Parameters Definitions */
+#define FIXED_Q8_8_SHIFT                         8
+#define FIXED_Q8_8_ONE                           ((sint16)1 << FIXED_Q8_8_SHIFT)
+#define FIXED_Q8_8_MAX                           ((sint16)32767)
+#define FIXED_Q8_8_MIN                           ((sint16)(-32767 - 1))
+
+#define FIXED_Q16_16_SHIFT                       16
+#define FIXED_Q16_16_ONE                         ((sint32)1 << FIXED_Q16_16_SHIFT)
+#define FIXED_Q16_16_MAX                         ((sint32)2147483647L)
+#define FIXED_Q16_16_MIN                         ((sint32)(-2147483647L - 1))
+
+/*
+ * Constants from decimal values, rounded to the nearest step. Only for constant
+ * expressions: the float arithmetic is folded by the compiler, never run.
+ */
+#define FIXED_Q8_8(VALUE)                        ((sint16)((VALUE) * 256.0 + (((VALUE) >= 0) ? 0.5 : -0.5)))
+#define FIXED_Q16_16(VALUE)                      ((sint32)((VALUE) * 65536.0 + (((VALUE) >= 0) ? 0.5 : -0.5)))
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clamp a 32-bit intermediate result to the sint16 range of a Q8.8 value.
+ */
+sint16 Fixed_saturate16 (sint32 value);
+
+/*
+ * Description :
+ * Return a + b of two Q8.8 values, saturated instead of wrapping.
+ */
+sint16 Fixed_addQ8_8 (sint16 a, sint16 b);
+
+/*
+ * Description :
+ * Return a * b of two Q8.8 values rounded to the nearest Q8.8 step and saturated.
+ */
+sint16 Fixed_mulQ8_8 (sint16 a, sint16 b);
+
+/*
+ * Description :
+ * Return a + b of two Q16.16 values, saturated instead of wrapping.
+ */
+sint32 Fixed_addQ16_16 (sint32 a, sint32 b);
+
+/*
+ * Description :
+ * Return value * factor with the factor holding the given number of fraction bits
+ * (e.g. a Q4.12 or Q2.14 gain), rounded to the nearest integer. The product must fit
+ * in 32 bits.
+ */
+sint32 Fixed_mulShift (sint32 value, sint32 factor, uint8 shift);
+
+/*
+ * Description :
+ * Return the fixed point value with the given number of fraction bits rounded to
+ * the nearest integer, halves away from zero.
+ */
+sint32 Fixed_round (sint32 value, uint8 shift);
+
+/*
+ * Description :
+ * Return value * numerator / denominator rounded down, e.g. to turn a percent
+ * into a timer compare value. value * numerator must fit in 32 bits.
+ */
+uint32 Fixed_scale (uint32 value, uint32 numerator, uint32 denominator);
+
+/*
+ * Description :
+ * Same as Fixed_scale but rounded up.
+ */
+uint32 Fixed_scaleCeil (uint32 value, uint32 numerator, uint32 denominator);
+
+/*
+ * Description :
+ * Same as Fixed_scale but rounded to the nearest integer.
+ */
+uint32 Fixed_scaleRound (uint32 value, uint32 numerator, uint32 denominator);
+
+/*
+ * Description :
+ * Return the square root of the value rounded down, with shifts and adds only.
+ * A Q(2n) value gives a Qn root, e.g. the root of a Q16.16 variance is Q8.8.
+ */
+uint16 Fixed_sqrt (uint32 value);
+
+#endif /* FIXED_POINT_H_ */
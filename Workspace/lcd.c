@@ -14,10 +14,29 @@
 
 #include <stdlib.h>
 #include <util/delay.h>
+#include <avr/pgmspace.h>
 #include "common_macros.h"
 #include "LCD.h"
 #include "gpio.h"
 
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Initialization commands in their order in the flash memory, sent by LCD_init or one per LCD_initStep */
+static const uint8 g_initCommands[] PROGMEM = {
+#if (LCD_BIT_MODE == 4)
+	LCD_4BITS_INIT1, LCD_4BITS_INIT2, LCD_4BITS_MODE,     /* use 2-line lcd + 4-bit Data Mode + 5*7 dot display Mode */
+#elif (LCD_BIT_MODE == 8)
+	LCD_8BITS_MODE,                                       /* use 2-line lcd + 8-bit Data Mode + 5*7 dot display Mode */
+#endif
+	DISPLAY_ON_CURSOR_OFF,
+	CLEAR_DISPLAY                                         /* Clear LCD at the beginning */
+};
+#define LCD_NUM_OF_INIT_COMMANDS             (sizeof(g_initCommands) / sizeof(g_initCommands[0]))
+
+static uint8 g_initStep = 0;
+
 /*******************************************************************************
  *                      Functions Definitions                                  *
  *******************************************************************************/
@@ -29,6 +48,18 @@
  * 2. Setup the LCD Data Mode 4-bits or 8-bits.
  */
 void LCD_init(void)
+{
+	LCD_startInit ();
+	while (!LCD_initStep ());
+}
+
+/*
+ * Description :
+ * Incremental form of LCD_init for a boot which must not block: LCD_startInit sets
+ * the pins directions, then every LCD_initStep sends the next initialization command
+ * and returns TRUE once the LCD is ready. Wait LCD_POWER_UP_MS after the reset first.
+ */
+void LCD_startInit(void)
 {
 	/* Configure the direction for RS and E pins as output pins */
 	GPIO_setupPinDirection (LCD_RS_PORT, LCD_RS_PIN, PIN_OUTPUT);
@@ -40,22 +71,22 @@ void LCD_init(void)
 	GPIO_setupPinDirection (LCD_DATA_PORT, LCD_D5_PIN, PIN_OUTPUT);
 	GPIO_setupPinDirection (LCD_DATA_PORT, LCD_D6_PIN, PIN_OUTPUT);
 	GPIO_setupPinDirection (LCD_DATA_PORT, LCD_D7_PIN, PIN_OUTPUT);
-
-	/* use 2-line lcd + 4-bit Data Mode + 5*7 dot display Mode */
-	LCD_sendCommand (LCD_4BITS_INIT1);
-	LCD_sendCommand (LCD_4BITS_INIT2);
-	LCD_sendCommand (LCD_4BITS_MODE);
-
 #elif (LCD_BIT_MODE == 8)
 	/* Configure the data port as output port */
 	GPIO_setupPortDirection (LCD_DATA_PORT, PORT_OUTPUT);
-
-	/* use 2-line lcd + 8-bit Data Mode + 5*7 dot display Mode */
-	LCD_sendCommand (LCD_8BITS_MODE);
 #endif
 
-	LCD_sendCommand(DISPLAY_ON_CURSOR_OFF);
-	LCD_sendCommand(CLEAR_DISPLAY);            /* Clear LCD at the beginning */
+	g_initStep = 0;
+}
+
+bool LCD_initStep(void)
+{
+	if (g_initStep < LCD_NUM_OF_INIT_COMMANDS)
+	{
+		LCD_sendCommand (pgm_read_byte (&g_initCommands[g_initStep]));
+		g_initStep++;
+	}
+	return (g_initStep == LCD_NUM_OF_INIT_COMMANDS);
 }
 
 /*
@@ -150,7 +181,7 @@ void LCD_sendData(uint8 data)
  * Description :
  * Display the required string on the screen
  */
-void LCD_displayString(char * ptr)
+void LCD_displayString(const char * ptr)
 {
 	uint8 i;
 	for(i = 0; ptr[i] != '\0'; i++)
@@ -159,6 +190,22 @@ void LCD_displayString(char * ptr)
 	}
 }
 
+/*
+ * Description :
+ * Display the required string stored in the flash memory (PROGMEM) on the screen,
+ * the string is read byte by byte so it never takes space in the SRAM.
+ */
+void LCD_displayString_P(const char * ptr)
+{
+	char character = pgm_read_byte (ptr);
+	while (character != '\0')
+	{
+		LCD_sendData(character);
+		ptr++;
+		character = pgm_read_byte (ptr);
+	}
+}
+
 /*
  * Description :
  * Move the cursor to a specified row and column index on the screen
@@ -223,3 +270,20 @@ void LCD_createCharacter(uint8 location, uint8* character)
 		LCD_sendData (character[i]);
 	}
 }
+
+/*
+ * Description :
+ * Create a specific character pattern in the CGROM from a pattern stored in the flash memory (PROGMEM)
+ */
+void LCD_createCharacter_P(uint8 location, const uint8* character)
+{
+	uint8 i = 0;
+	/* Move the LCD to the first byte address for the new character block in CGROM */
+	LCD_sendCommand (CGROM_ADDRESS + (location*8));
+
+	/* Fill the CGROM block byte by byte with the pattern read from the flash memory */
+	for (i = 0; i < 8; i++)
+	{
+		LCD_sendData (pgm_read_byte (&character[i]));
+	}
+}
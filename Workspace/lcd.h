@@ -21,15 +21,33 @@
  *                                Definitions                                  *
  *******************************************************************************/
 
+/*
+ * Static Configurations of the wiring:
+ * 0 = the wiring of the Proteus project, 8-bit data on PC0..PC7, RS on PD0 and EN on PD2.
+ * 1 = 4-bit data D4..D7 on PC3..PC6, RS on PD3 and EN on PD2. This leaves PC0/PC1 free
+ *     for the TWI (SCL/SDA) and PD0/PD1 for the USART (RXD/TXD) of the Modbus slave.
+ */
+#define LCD_PIN_REMAP                        0
+#if (LCD_PIN_REMAP != 0 && LCD_PIN_REMAP != 1)
+#error "The LCD pin remap must be 0 or 1"
+#endif
+
 /* LCD_DATA_MODES */
+#if (LCD_PIN_REMAP == 1)
+#define LCD_BIT_MODE 4
+#else
 #define LCD_BIT_MODE 8
+#endif
 #if (LCD_BIT_MODE != 8 && LCD_BIT_MODE != 4)
 #error "The Bit Mode Is Wrong"
 #endif
 
-/* Static Configurations */
 #define LCD_RS_PORT                          PORTD_ID
+#if (LCD_PIN_REMAP == 1)
+#define LCD_RS_PIN                           PIN3_ID
+#else
 #define LCD_RS_PIN                           PIN0_ID
+#endif
 
 #define LCD_EN_PORT                          PORTD_ID
 #define LCD_EN_PIN                           PIN2_ID
@@ -53,6 +71,9 @@
 #define DISPLAY_ON_CURSOR_OFF                0x0C
 #define CLEAR_DISPLAY                        0x01
 
+/* Power-up time of the controller before the first command, counted from the reset */
+#define LCD_POWER_UP_MS                      40
+
 /* LCD_MEMORIES */
 #define FIRST_ROW_ADDRESS                    0x00
 #define SECOND_ROW_ADDRESS                   0x40
@@ -72,6 +93,15 @@
  */
 void LCD_init(void);
 
+/*
+ * Description :
+ * Incremental form of LCD_init for a boot which must not block: LCD_startInit sets
+ * the pins directions, then every LCD_initStep sends the next initialization command
+ * and returns TRUE once the LCD is ready. Wait LCD_POWER_UP_MS after the reset first.
+ */
+void LCD_startInit(void);
+bool LCD_initStep(void);
+
 /*
  * Description :
  * Send the required command to the screen
@@ -88,7 +118,14 @@ void LCD_sendData(uint8 data);
  * Description :
  * Display the required string on the screen
  */
-void LCD_displayString(char * ptr);
+void LCD_displayString(const char * ptr);
+
+/*
+ * Description :
+ * Display the required string stored in the flash memory (PROGMEM) on the screen,
+ * the string is read byte by byte so it never takes space in the SRAM.
+ */
+void LCD_displayString_P(const char * ptr);
 
 /*
  * Description :
@@ -114,4 +151,10 @@ void LCD_displayInteger(sint32 num);
  */
 void LCD_createCharacter(uint8 location, uint8* character);
 
+/*
+ * Description :
+ * Create a specific character pattern in the CGROM from a pattern stored in the flash memory (PROGMEM)
+ */
+void LCD_createCharacter_P(uint8 location, const uint8* character);
+
 #endif /* LCD_H_ */
@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ * Module: LM75
+ *
+ * File Name: lm75.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the LM75 / TMP102 I2C temperature sensor driver,
+ *              a state machine polling the interrupt driven TWI transfers.
+ *
+ *******************************************************************************/
+
+#include "lm75.h"
+#include "twi.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static const uint8 g_pointer = LM75_TEMPERATURE_REGISTER;
+static uint8 g_rxBuffer[2];
+
+static bool g_busy = FALSE;
+static uint32 g_nextStartTick = 0;
+static uint32 g_timeoutTick = 0;
+
+static LM75_StatusType g_status = LM75_STATUS_NO_DATA;
+static sint16 g_temperature = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static bool LM75_isDue (uint32 tick)
+{
+	return ((sint32)(SysTick_getTicks () - tick) >= 0) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Initialize the TWI master, the first reading starts on the next step.
+ */
+void LM75_init (void)
+{
+	TWI_init ();
+	g_busy = FALSE;
+	g_status = LM75_STATUS_NO_DATA;
+	g_nextStartTick = SysTick_getTicks ();
+}
+
+/*
+ * Description :
+ * Start a temperature register read every LM75_PERIOD_MS and collect its result
+ * once the TWI interrupt finished it. Never waits for the bus. Called every loop iteration.
+ */
+void LM75_step (void)
+{
+	if (!g_busy)
+	{
+		/* Set the register pointer then read the two temperature bytes after a repeated start */
+		if (LM75_isDue (g_nextStartTick) &&
+				TWI_startTransfer (LM75_ADDRESS, &g_pointer, 1, g_rxBuffer, sizeof(g_rxBuffer)))
+		{
+			g_nextStartTick += SYS_TICK_MS_TO_TICKS (LM75_PERIOD_MS);
+			g_timeoutTick = SysTick_getTicks () + SYS_TICK_MS_TO_TICKS (LM75_TIMEOUT_MS);
+			g_busy = TRUE;
+		}
+		return;
+	}
+
+	switch (TWI_getStatus ())
+	{
+	case TWI_DONE:
+		/* Left justified two's complement with the integer part in the first byte, which is Q8.8 */
+		g_temperature = (sint16)(((uint16)g_rxBuffer[0] << 8) | g_rxBuffer[1]);
+		g_status = LM75_STATUS_OK;
+		g_busy = FALSE;
+		break;
+	case TWI_ERROR:
+		g_status = LM75_STATUS_NO_DEVICE;
+		g_busy = FALSE;
+		break;
+	default:
+		if (LM75_isDue (g_timeoutTick))
+		{
+			/* A slave holding SDA low, restart the TWI module */
+			TWI_init ();
+			g_status = LM75_STATUS_TIMEOUT;
+			g_busy = FALSE;
+		}
+		break;
+	}
+}
+
+/*
+ * Description :
+ * Copy the last valid temperature in Q8.8 C.
+ * Returns the status of the last reading.
+ */
+LM75_StatusType LM75_getTemperature (sint16 * Temperature_Ptr)
+{
+	*Temperature_Ptr = g_temperature;
+	return g_status;
+}
+
+/*******************************************************************************
+ *                      Sensor Interface Definitions                           *
+ *******************************************************************************/
+static void LM75_sensorInit (uint8 channel)
+{
+	(void)channel;
+	LM75_init ();
+}
+
+static sint16 LM75_sensorRead (uint8 channel)
+{
+	(void)channel;
+	return g_temperature;
+}
+
+/* The raw reading is already Q8.8 C */
+static sint16 LM75_sensorConvert (sint16 raw)
+{
+	return raw;
+}
+
+static Sensor_StatusType LM75_sensorStatus (uint8 channel)
+{
+	(void)channel;
+	switch (g_status)
+	{
+	case LM75_STATUS_OK:
+		return SENSOR_STATUS_OK;
+	case LM75_STATUS_NO_DATA:
+		return SENSOR_STATUS_NO_DATA;
+	default:
+		return SENSOR_STATUS_FAULT;
+	}
+}
+
+const Sensor_InterfaceType LM75_sensorInterface = {
+	LM75_sensorInit, LM75_step, LM75_sensorRead, LM75_sensorConvert, LM75_sensorStatus
+};
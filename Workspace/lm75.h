@@ -0,0 +1,73 @@
+/******************************************************************************
+ *
+ * Module: LM75
+ *
+ * File Name: lm75.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the LM75 / TMP102 I2C temperature sensor driver,
+ *              a state machine polling the interrupt driven TWI transfers.
+ *
+ *******************************************************************************/
+
+#ifndef LM75_H_
+#define LM75_H_
+
+#include "std_types.h"
+#include "sensor.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations, LM75 with A2..A0 tied to ground (TMP102 with ADD0 to ground is 0x48 too) */
+#define LM75_ADDRESS                             0x48
+#define LM75_PERIOD_MS                           500
+#define LM75_TIMEOUT_MS                          50
+
+/* Registers */
+#define LM75_TEMPERATURE_REGISTER                0x00
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	LM75_STATUS_NO_DATA, LM75_STATUS_OK, LM75_STATUS_NO_DEVICE, LM75_STATUS_TIMEOUT
+} LM75_StatusType;
+
+/*******************************************************************************
+ *                           External Variables                                *
+ *******************************************************************************/
+
+/* Sensor interface of the LM75 / TMP102, the raw reading is the last valid temperature in Q8.8 C */
+extern const Sensor_InterfaceType LM75_sensorInterface;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Initialize the TWI master, the first reading starts on the next step.
+ */
+void LM75_init (void);
+
+/*
+ * Description :
+ * Start a temperature register read every LM75_PERIOD_MS and collect its result
+ * once the TWI interrupt finished it. Never waits for the bus. Called every loop iteration.
+ */
+void LM75_step (void);
+
+/*
+ * Description :
+ * Copy the last valid temperature in Q8.8 C.
+ * Returns the status of the last reading.
+ */
+LM75_StatusType LM75_getTemperature (sint16 * Temperature_Ptr);
+
+#endif /* LM75_H_ */
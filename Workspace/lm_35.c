@@ -15,6 +15,95 @@
 #include "lm_35.h"
 #include "std_types.h"
 #include "adc.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* ADC code at the full scale output of the sensor, anything above is a wiring fault */
+#define LM_35_MAX_CODE                           ((uint16)(LM_35_MAX_VOLTAGE * ADC_MAX_DIGITAL_VALUE / ADC_VOLTAGE_REFERENCE))
+
+/* Q8.8 C per ADC code as an integer ratio, both terms scaled by 10 to keep the decimals */
+#define LM_35_Q8_8_NUMERATOR                     ((uint32)(LM_35_MAX_TEMPERATURE * ADC_VOLTAGE_REFERENCE * 256 * 10 + 0.5))
+#define LM_35_Q8_8_DENOMINATOR                   ((uint32)(ADC_MAX_DIGITAL_VALUE * LM_35_MAX_VOLTAGE * 10 + 0.5))
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static uint16 g_lastCode = 0;
+
+/* Running sums of the current noise window and the result of the last complete one */
+static uint16 g_noiseSum = 0;
+static uint32 g_noiseSumSquares = 0;
+static uint8 g_noiseCount = 0;
+static uint16 g_noise = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * Add the code to the noise window. The sample variance (n.S2 - S1^2) / (n.(n - 1)) of
+ * a complete window is taken in Q16.16 codes^2, its root is the deviation in Q8.8 codes.
+ * The window is short enough for the temperature drift to stay below the noise.
+ */
+static void LM_35_updateNoise (uint16 code)
+{
+	uint32 spread;
+
+	g_noiseSum += code;
+	g_noiseSumSquares += (uint32)code * code;
+	g_noiseCount++;
+	if (g_noiseCount < LM_35_NOISE_WINDOW)
+	{
+		return;
+	}
+
+	spread = (uint32)LM_35_NOISE_WINDOW * g_noiseSumSquares - (uint32)g_noiseSum * g_noiseSum;
+	if (spread >= ((uint32)1 << 24))
+	{
+		g_noise = 0xFFFF;                       /* Above 64 codes, a wiring fault rather than noise */
+	}
+	else
+	{
+		g_noise = Fixed_sqrt (((spread << 8) / (LM_35_NOISE_WINDOW * (LM_35_NOISE_WINDOW - 1))) << 8);
+	}
+	g_noiseSum = 0;
+	g_noiseSumSquares = 0;
+	g_noiseCount = 0;
+}
+
+/* Conversion in integer math only, the raw reading is the ADC code */
+static sint16 LM_35_read (uint8 channel)
+{
+	g_lastCode = ADC_readChannel (channel);
+	LM_35_updateNoise (g_lastCode);
+	return (sint16)g_lastCode;
+}
+
+static sint16 LM_35_convert (sint16 raw)
+{
+	uint32 temperature = Fixed_scaleRound ((uint16)raw, LM_35_Q8_8_NUMERATOR, LM_35_Q8_8_DENOMINATOR);
+
+	/* Q8.8 stops at 127.99 C, above the last fan curve threshold */
+	return Fixed_saturate16 (temperature);
+}
+
+static Sensor_StatusType LM_35_status (uint8 channel)
+{
+	(void)channel;
+	return (g_lastCode > LM_35_MAX_CODE) ? SENSOR_STATUS_FAULT : SENSOR_STATUS_OK;
+}
+
+/*******************************************************************************
+ *                      Sensor Interface Definitions                           *
+ *******************************************************************************/
+const Sensor_InterfaceType LM_35_sensorInterface = {NULL_PTR, NULL_PTR, LM_35_read, LM_35_convert, LM_35_status};
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
 
 /*
  * Description :
@@ -27,9 +116,19 @@ uint8 LM_35_readTemp (void)
 
 	/* Read ADC channel where the temperature sensor is connected */
 	digitalRead =  ADC_readChannel (LM_35_SENSOR_CHANNEL);
+	LM_35_updateNoise (digitalRead);
 
-	/* Calculate the temperature from the ADC value */
-	temp =(uint8)((LM_35_MAX_TEMPERATURE * (uint32)digitalRead * ADC_VOLTAGE_REFERENCE) \
-			/ (ADC_MAX_DIGITAL_VALUE * LM_35_MAX_VOLTAGE));
+	/* Calculate the temperature from the ADC value, whole degrees rounded down */
+	temp = (uint8)Fixed_scale (digitalRead, LM_35_Q8_8_NUMERATOR, LM_35_Q8_8_DENOMINATOR << FIXED_Q8_8_SHIFT);
 	return temp;
 }
+
+/*
+ * Description :
+ * Return the sample standard deviation of the ADC codes of the last LM_35_NOISE_WINDOW
+ * readings in Q8.8 codes, 0 before the first window and 0xFFFF when out of range.
+ */
+uint16 LM_35_getNoise (void)
+{
+	return g_noise;
+}
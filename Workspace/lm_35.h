@@ -15,6 +15,7 @@
 #define LM_35_H_
 
 #include "std_types.h"
+#include "sensor.h"
 
 /*******************************************************************************
  *                                Definitions                                  *
@@ -22,11 +23,23 @@
 
 /* Static Configurations */
 #define LM_35_SENSOR_CHANNEL                     2
+#define LM_35_NOISE_WINDOW                       64         /* Readings per noise measurement, 64 at most */
+
+#if (LM_35_NOISE_WINDOW < 2) || (LM_35_NOISE_WINDOW > 64)
+#error "LM_35_NOISE_WINDOW must be 2 .. 64, larger windows overflow the 32-bit sums"
+#endif
 
 /* Parameters Definitions */
 #define LM_35_MAX_TEMPERATURE                    150
 #define LM_35_MAX_VOLTAGE                        1.5
 
+/*******************************************************************************
+ *                           External Variables                                *
+ *******************************************************************************/
+
+/* Sensor interface of the LM35 on an ADC channel, the raw reading is the ADC code */
+extern const Sensor_InterfaceType LM_35_sensorInterface;
+
 /*******************************************************************************
  *                      Functions Prototypes                                   *
  *******************************************************************************/
@@ -37,4 +50,11 @@
  */
 uint8 LM_35_readTemp (void);
 
+/*
+ * Description :
+ * Return the sample standard deviation of the ADC codes of the last LM_35_NOISE_WINDOW
+ * readings in Q8.8 codes, 0 before the first window and 0xFFFF when out of range.
+ */
+uint16 LM_35_getNoise (void);
+
 #endif /* LM_35_H_ */
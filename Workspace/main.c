@@ -6,25 +6,48 @@
  */
 
 #include "std_types.h"
-#include "lcd.h"
+#include "boot_time.h"
 #include "dc_motor.h"
 #include "lm_35.h"
+#include "sensor_cfg.h"
 #include "adc.h"
+#include "fan_control.h"
+#include "autotune.h"
+#include "pid_storage.h"
+#include "buttons.h"
+#include "sys_tick.h"
+#include "temp_history.h"
+#include "ui.h"
+#include "watchdog.h"
+#include "modbus_rtu.h"
+#include <avr/interrupt.h>
 
 /*******************************************************************************
- *                                Definitions                                  *
+ *                      Private Functions Definitions                          *
  *******************************************************************************/
-#define ON                             1
-#define OFF                            0
-#define MAX_SPEED                      100
-#define THREE_QUARTERS_SPEED           75
-#define HALF_SPEED                     50
-#define QUARTER_SPEED                  25
 
-/*******************************************************************************
- *                                    Globals                                  *
- *******************************************************************************/
-uint8 g_motorState = OFF;
+/*
+ * Description :
+ * Called by the deadline monitor before the watchdog reset, a hung loop must
+ * leave the fan at full speed instead of its last duty.
+ */
+static void App_enterSafeState (void)
+{
+	DcMotor_rotate (CW, DC_MAX_SPEED);
+}
+
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+/*
+ * Description :
+ * Called by the auto-tuning when it succeeds, the controller takes the new gains
+ * at once and they are queued for the EEPROM so they survive a reset.
+ */
+static void App_storeGains (const Autotune_ResultType * Result_Ptr)
+{
+	FanControl_setPidGains (&Result_Ptr -> gains);
+	PidStorage_save (&Result_Ptr -> gains);
+}
+#endif
 
 /*******************************************************************************
  *                      Functions Definitions                                  *
@@ -33,74 +56,112 @@ int main (void)
 {
 	/* Created as register variable as it will be used too much in the program */
 	register uint8 temprature = 0;
-
-	/* ADC initialization Vref and prescaler */
+	uint8 speed = 0;
+	Buttons_IdType button;
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	Pid_GainsType gains;
+#endif
+	sint16 controlTemperature;
+	bool sensorOk;
 	ADC_ConfigType s_configuration = {INTERNAL, FCPU_8};
-	ADC_init (& s_configuration);
 
-	/* Initialize LCD and DC motor modules */
-	LCD_init();
+	/*
+	 * Fast boot: a hot enclosure must not wait for the slow modules, so the fan is driven
+	 * from a first LM35 reading (against the uncalibrated reference) within a millisecond
+	 * of the reset, and the time to this first PWM duty is measured.
+	 */
+	BootTime_start ();
+	ADC_init (& s_configuration);
 	DcMotor_init();
+	FanControl_init();
+	speed = FanControl_update (LM_35_readTemp ());
+	BootTime_markFirstPwm ();
+
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	/* Gains of a previous auto-tuning replace the ones of fan_curve.h */
+	if (PidStorage_load (&gains))
+	{
+		FanControl_setPidGains (&gains);
+	}
+	Autotune_setCallBack (App_storeGains);
+#endif
+
+	/* The history is sampled from the loop every TEMP_HISTORY_SAMPLE_PERIOD_S */
+	TempHistory_init();
+
+	/* The LCD and the bar graph glyphs are brought up by the loop, then one row is drawn per iteration after each page change */
+	UI_init();
+
+	/* The buttons are sampled and debounced from the system tick interrupt */
+	Buttons_init();
+	SysTick_setCallBack (Buttons_scan);
+	SysTick_init();
 
-	/* Display the fixed data on LCD */
-	LCD_moveCursor (1,3);
-	LCD_displayString ("FAN IS ");
-	LCD_moveCursor (2,2);
-	LCD_displayString ("TEMP =     C");
+	/* Initialize the sensors of sensor_cfg.c, the digital ones time their conversions on the system tick */
+	Sensor_init();
+
+	/* Start monitoring the loop deadline once the slow initialization is done */
+	Watchdog_setCallBack (App_enterSafeState);
+	Watchdog_init ();
+
+	/* The Modbus slave times the end of its frames on Timer1, started by the deadline monitor */
+#if (MODBUS_RTU_ENABLE == 1)
+	ModbusRtu_init ();
+#endif
+	sei ();
 
 	for(;;)
 	{
-		temprature = LM_35_readTemp ();               /* Read the temperature each loop */
-		/* Display the temperature on LCD */
-		LCD_moveCursor (2,9);
-		if (temprature >= 100)
-		{
-			LCD_displayInteger((sint32)temprature);
-		}
-		else
+		/* Sample the sensors each loop, only a valid reading enters the history */
+		Sensor_update ();
+		sensorOk = (Sensor_getTemperature (SENSOR_CONTROL_ID, &controlTemperature) == SENSOR_STATUS_OK);
+		temprature = Sensor_getCelsius (SENSOR_CONTROL_ID);
+		if (sensorOk)
 		{
-			LCD_displayInteger((sint32)temprature);
-			LCD_sendData (' ');
+			TempHistory_update (TEMP_HISTORY_CONTROL_CHANNEL, temprature);
 		}
+		Watchdog_checkIn (WATCHDOG_TASK_SENSE);
 
-		/* Check the temperature value then determine the speed and state of the fan */
-		if (temprature >= 120)
-		{
-			DcMotor_rotate (CW, MAX_SPEED);
-			g_motorState = ON;
-		}
-		else if (temprature >= 90)
-		{
-			DcMotor_rotate (CW, THREE_QUARTERS_SPEED);
-			g_motorState = ON;
-		}
-		else if (temprature >= 60)
+		/*
+		 * Determine the speed of the fan from the fan curve and drive the motor with it,
+		 * or from the relay while an auto-tuning runs. Without a valid reading the fan
+		 * runs at full speed, the tuning stops and the policy (PID, slope) is not updated.
+		 */
+		if (!sensorOk)
 		{
-			DcMotor_rotate (CW, HALF_SPEED);
-			g_motorState = ON;
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+			Autotune_abort ();
+#endif
+			speed = FanControl_apply (DC_MAX_SPEED);
 		}
-		else if (temprature >= 30)
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+		else if (Autotune_getState () == AUTOTUNE_RUNNING)
 		{
-			DcMotor_rotate (CW, QUARTER_SPEED);
-			g_motorState = ON;
+			speed = FanControl_apply (Autotune_update (controlTemperature));
 		}
+#endif
 		else
 		{
-			DcMotor_stop ();
-			g_motorState = OFF;
+			speed = FanControl_update (temprature);
 		}
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+		PidStorage_step ();
+#endif
+		Watchdog_checkIn (WATCHDOG_TASK_CONTROL);
 
-		/* Display the fan state after determining it */
-		switch (g_motorState)
+		/* Apply the button presses queued by the tick interrupt then redraw what changed */
+		while (Buttons_getEvent (&button))
 		{
-		case ON:
-			LCD_moveCursor (1,10);
-			LCD_displayString("ON ");
-			break;
-		case OFF:
-			LCD_moveCursor (1,10);
-			LCD_displayString("OFF");
+			UI_handleButton (button);
 		}
+		UI_update (temprature, speed);
+		Watchdog_checkIn (WATCHDOG_TASK_DISPLAY);
+
+		/* Answer the Modbus request received by the interrupts, if any */
+#if (MODBUS_RTU_ENABLE == 1)
+		ModbusRtu_step ();
+#endif
+
+		Watchdog_service ();                           /* Close the loop iteration and kick the watchdog */
 	}
 }
-
@@ -0,0 +1,240 @@
+/******************************************************************************
+ *
+ * Module: MODBUS
+ *
+ * File Name: modbus.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the Modbus slave protocol: CRC and the register
+ *              functions served from the tables of modbus_cfg.c
+ *
+ *******************************************************************************/
+
+#include "modbus.h"
+#include "modbus_cfg.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define MODBUS_GET_WORD(FRAME, INDEX)            ((uint16)(((uint16)(FRAME)[INDEX] << 8) | (FRAME)[(INDEX) + 1]))
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void Modbus_putWord (uint8 * Frame_Ptr, uint8 index, uint16 value)
+{
+	Frame_Ptr[index] = (uint8)(value >> 8);    /* The registers are sent big-endian */
+	Frame_Ptr[index + 1] = (uint8)value;
+}
+
+static uint8 Modbus_exception (uint8 * Frame_Ptr, uint8 code)
+{
+	Frame_Ptr[1] |= MODBUS_EXCEPTION_FLAG;
+	Frame_Ptr[2] = code;
+	return 3;
+}
+
+/* Read registers request: start and quantity */
+static uint8 Modbus_readRegisters (uint8 * Frame_Ptr, uint8 length, const Modbus_RegisterType * Table_Ptr, uint16 tableSize)
+{
+	uint16 start;
+	uint16 quantity;
+	uint8 i;
+
+	if (length != 6)
+	{
+		return Modbus_exception (Frame_Ptr, MODBUS_ILLEGAL_DATA_VALUE);
+	}
+	start = MODBUS_GET_WORD (Frame_Ptr, 2);
+	quantity = MODBUS_GET_WORD (Frame_Ptr, 4);
+	if ((quantity == 0) || (quantity > MODBUS_MAX_REGISTERS))
+	{
+		return Modbus_exception (Frame_Ptr, MODBUS_ILLEGAL_DATA_VALUE);
+	}
+	if ((start >= tableSize) || (quantity > tableSize - start))
+	{
+		return Modbus_exception (Frame_Ptr, MODBUS_ILLEGAL_DATA_ADDRESS);
+	}
+
+	/* The request fields were read above, the response overwrites them */
+	Frame_Ptr[2] = (uint8)(2 * quantity);
+	for (i = 0; i < quantity; i++)
+	{
+		Modbus_putWord (Frame_Ptr, (uint8)(3 + 2 * i), Table_Ptr[start + i].read ());
+	}
+	return (uint8)(3 + 2 * quantity);
+}
+
+/* Check that every register of the range is writable with its new value before writing any */
+static uint8 Modbus_checkWrite (const uint8 * Values_Ptr, uint16 start, uint16 quantity)
+{
+	const Modbus_RegisterType * Register_Ptr;
+	uint16 value;
+	uint8 i;
+
+	if ((start >= MODBUS_NUM_OF_HOLDING_REGISTERS) || (quantity > MODBUS_NUM_OF_HOLDING_REGISTERS - start))
+	{
+		return MODBUS_ILLEGAL_DATA_ADDRESS;
+	}
+	for (i = 0; i < quantity; i++)
+	{
+		Register_Ptr = &g_modbusHoldingRegisters[start + i];
+		value = MODBUS_GET_WORD (Values_Ptr, 2 * i);
+		if (Register_Ptr -> write == NULL_PTR)
+		{
+			return MODBUS_ILLEGAL_DATA_ADDRESS;
+		}
+		if ((value < Register_Ptr -> min) || (value > Register_Ptr -> max))
+		{
+			return MODBUS_ILLEGAL_DATA_VALUE;
+		}
+	}
+	return 0;
+}
+
+static void Modbus_write (const uint8 * Values_Ptr, uint16 start, uint16 quantity)
+{
+	uint8 i;
+
+	for (i = 0; i < quantity; i++)
+	{
+		g_modbusHoldingRegisters[start + i].write (MODBUS_GET_WORD (Values_Ptr, 2 * i));
+	}
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Add one byte to the Modbus CRC-16 (polynomial 0xA001 reflected, MODBUS_CRC_INIT first).
+ * The CRC of a whole frame with its CRC bytes is zero when the frame is intact.
+ */
+uint16 Modbus_crcUpdate (uint16 crc, uint8 data)
+{
+	uint8 bit;
+
+	crc ^= data;
+	for (bit = 0; bit < 8; bit++)
+	{
+		crc = (crc & 0x0001) ? ((crc >> 1) ^ 0xA001) : (crc >> 1);
+	}
+	return crc;
+}
+
+/*
+ * Description :
+ * Return the Modbus CRC-16 of the given bytes.
+ */
+uint16 Modbus_crc16 (const uint8 * Data_Ptr, uint8 length)
+{
+	uint16 crc = MODBUS_CRC_INIT;
+	uint8 i;
+
+	for (i = 0; i < length; i++)
+	{
+		crc = Modbus_crcUpdate (crc, Data_Ptr[i]);
+	}
+	return crc;
+}
+
+/*
+ * Description :
+ * Append the CRC of the first length bytes of the frame (low byte first).
+ * Returns the new frame length.
+ */
+uint8 Modbus_appendCrc (uint8 * Frame_Ptr, uint8 length)
+{
+	uint16 crc = Modbus_crc16 (Frame_Ptr, length);
+
+	Frame_Ptr[length] = (uint8)crc;
+	Frame_Ptr[length + 1] = (uint8)(crc >> 8);
+	return (uint8)(length + MODBUS_CRC_SIZE);
+}
+
+/*
+ * Description :
+ * Execute a request with a checked CRC (address, function and data, the CRC stripped)
+ * and build the response in the same buffer of MODBUS_FRAME_SIZE bytes:
+ * 1. Read holding (0x03) and input (0x04) registers, write a single holding register
+ *    (0x06) or several ones (0x10) from the tables of modbus_cfg.c.
+ * 2. A request which cannot be executed gets an exception response and writes nothing.
+ * Returns the response length without the CRC, zero if no response must be sent
+ * (another slave or a broadcast).
+ */
+uint8 Modbus_handleFrame (uint8 * Frame_Ptr, uint8 length)
+{
+	uint8 address;
+	uint8 response;
+	uint8 error;
+	uint16 start;
+	uint16 quantity;
+
+	if (length < 2)
+	{
+		return 0;
+	}
+	address = Frame_Ptr[0];
+	if ((address != MODBUS_SLAVE_ADDRESS) && (address != MODBUS_BROADCAST_ADDRESS))
+	{
+		return 0;
+	}
+
+	switch (Frame_Ptr[1])
+	{
+	case MODBUS_READ_HOLDING_REGISTERS:
+		response = Modbus_readRegisters (Frame_Ptr, length, g_modbusHoldingRegisters, MODBUS_NUM_OF_HOLDING_REGISTERS);
+		break;
+
+	case MODBUS_READ_INPUT_REGISTERS:
+		response = Modbus_readRegisters (Frame_Ptr, length, g_modbusInputRegisters, MODBUS_NUM_OF_INPUT_REGISTERS);
+		break;
+
+	case MODBUS_WRITE_SINGLE_REGISTER:
+		if (length != 6)
+		{
+			response = Modbus_exception (Frame_Ptr, MODBUS_ILLEGAL_DATA_VALUE);
+			break;
+		}
+		start = MODBUS_GET_WORD (Frame_Ptr, 2);
+		error = Modbus_checkWrite (&Frame_Ptr[4], start, 1);
+		if (error != 0)
+		{
+			response = Modbus_exception (Frame_Ptr, error);
+			break;
+		}
+		Modbus_write (&Frame_Ptr[4], start, 1);
+		response = 6;                          /* The response echoes the request */
+		break;
+
+	case MODBUS_WRITE_MULTIPLE_REGISTERS:
+		quantity = (length >= 7) ? MODBUS_GET_WORD (Frame_Ptr, 4) : 0;
+		if ((quantity == 0) || (quantity > MODBUS_MAX_REGISTERS) || (Frame_Ptr[6] != 2 * quantity) ||
+				(length != 7 + 2 * quantity))
+		{
+			response = Modbus_exception (Frame_Ptr, MODBUS_ILLEGAL_DATA_VALUE);
+			break;
+		}
+		start = MODBUS_GET_WORD (Frame_Ptr, 2);
+		error = Modbus_checkWrite (&Frame_Ptr[7], start, quantity);
+		if (error != 0)
+		{
+			response = Modbus_exception (Frame_Ptr, error);
+			break;
+		}
+		Modbus_write (&Frame_Ptr[7], start, quantity);
+		response = 6;                          /* Address, function, start and quantity */
+		break;
+
+	default:
+		response = Modbus_exception (Frame_Ptr, MODBUS_ILLEGAL_FUNCTION);
+		break;
+	}
+
+	/* A broadcast is executed but never answered */
+	return (address == MODBUS_BROADCAST_ADDRESS) ? 0 : response;
+}
@@ -0,0 +1,105 @@
+/******************************************************************************
+ *
+ * Module: MODBUS
+ *
+ * File Name: modbus.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the Modbus slave protocol: CRC and the register
+ *              functions served from the tables of modbus_cfg.c
+ *
+ *******************************************************************************/
+
+#ifndef MODBUS_H_
+#define MODBUS_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define MODBUS_SLAVE_ADDRESS                     1
+#define MODBUS_MAX_REGISTERS                     16         /* Registers per read or write request */
+
+/* Parameters Definitions */
+#define MODBUS_BROADCAST_ADDRESS                 0
+#define MODBUS_CRC_INIT                          0xFFFF
+#define MODBUS_CRC_SIZE                          2
+
+/* Largest frame with the CRC: a write multiple registers request */
+#define MODBUS_FRAME_SIZE                        (7 + 2 * MODBUS_MAX_REGISTERS + MODBUS_CRC_SIZE)
+
+#define MODBUS_READ_HOLDING_REGISTERS            0x03
+#define MODBUS_READ_INPUT_REGISTERS              0x04
+#define MODBUS_WRITE_SINGLE_REGISTER             0x06
+#define MODBUS_WRITE_MULTIPLE_REGISTERS          0x10
+#define MODBUS_EXCEPTION_FLAG                    0x80
+
+#define MODBUS_ILLEGAL_FUNCTION                  0x01
+#define MODBUS_ILLEGAL_DATA_ADDRESS              0x02
+#define MODBUS_ILLEGAL_DATA_VALUE                0x03
+
+#if ((MODBUS_SLAVE_ADDRESS < 1) || (MODBUS_SLAVE_ADDRESS > 247))
+#error "The Modbus slave address must be 1 .. 247"
+#endif
+#if ((MODBUS_MAX_REGISTERS < 1) || (MODBUS_MAX_REGISTERS > 120))
+#error "The Modbus frames must stay below 256 bytes"
+#endif
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/*
+ * One register of a table, its address is its index. The write function is
+ * NULL_PTR for a read-only register and is only called with min <= value <= max.
+ */
+typedef struct{
+	uint16 (*read)(void);
+	void (*write)(uint16 value);
+	uint16 min;
+	uint16 max;
+} Modbus_RegisterType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Add one byte to the Modbus CRC-16 (polynomial 0xA001 reflected, MODBUS_CRC_INIT first).
+ * The CRC of a whole frame with its CRC bytes is zero when the frame is intact.
+ */
+uint16 Modbus_crcUpdate (uint16 crc, uint8 data);
+
+/*
+ * Description :
+ * Return the Modbus CRC-16 of the given bytes.
+ */
+uint16 Modbus_crc16 (const uint8 * Data_Ptr, uint8 length);
+
+/*
+ * Description :
+ * Append the CRC of the first length bytes of the frame (low byte first).
+ * Returns the new frame length.
+ */
+uint8 Modbus_appendCrc (uint8 * Frame_Ptr, uint8 length);
+
+/*
+ * Description :
+ * Execute a request with a checked CRC (address, function and data, the CRC stripped)
+ * and build the response in the same buffer of MODBUS_FRAME_SIZE bytes:
+ * 1. Read holding (0x03) and input (0x04) registers, write a single holding register
+ *    (0x06) or several ones (0x10) from the tables of modbus_cfg.c.
+ * 2. A request which cannot be executed gets an exception response and writes nothing.
+ * Returns the response length without the CRC, zero if no response must be sent
+ * (another slave or a broadcast).
+ */
+uint8 Modbus_handleFrame (uint8 * Frame_Ptr, uint8 length);
+
+#endif /* MODBUS_H_ */
@@ -0,0 +1,248 @@
+/******************************************************************************
+ *
+ * Module: MODBUS
+ *
+ * File Name: modbus_cfg.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the register map served by the Modbus slave
+ *
+ *******************************************************************************/
+
+#include "modbus_cfg.h"
+#include "modbus_rtu.h"
+#include "sensor_cfg.h"
+#include "fan_control.h"
+#include "autotune.h"
+#include "watchdog.h"
+#include "lm_35.h"
+#include "adc.h"
+#include "boot_time.h"
+#include "sensor.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static uint16 ModbusCfg_saturate (uint32 value)
+{
+	return (value > 0xFFFF) ? 0xFFFF : (uint16)value;
+}
+
+static uint16 ModbusCfg_readTemperature (void)
+{
+	sint16 temperature = 0;
+
+	Sensor_getTemperature (SENSOR_CONTROL_ID, &temperature);
+	return (uint16)temperature;
+}
+
+static uint16 ModbusCfg_readSensorStatus (void)
+{
+	sint16 temperature;
+
+	return Sensor_getTemperature (SENSOR_CONTROL_ID, &temperature);
+}
+
+static uint16 ModbusCfg_readSpeed (void)
+{
+	return FanControl_getAppliedSpeed ();
+}
+
+static uint16 ModbusCfg_readRpm (void)
+{
+	return MODBUS_NOT_MEASURED;
+}
+
+static uint16 ModbusCfg_readFeedForward (void)
+{
+	return FanControl_getFeedForward ();
+}
+
+static uint16 ModbusCfg_readLoopPeriod (void)
+{
+	Watchdog_StatsType stats;
+
+	Watchdog_getStats (&stats);
+	return ModbusCfg_saturate (WATCHDOG_TICKS_TO_US (stats.maxPeriod));
+}
+
+static uint16 ModbusCfg_readLastLatency (void)
+{
+	ModbusRtu_StatsType stats;
+
+	ModbusRtu_getStats (&stats);
+	return ModbusCfg_saturate ((uint32)stats.lastLatency * MODBUS_RTU_TICK_US);
+}
+
+static uint16 ModbusCfg_readMaxLatency (void)
+{
+	ModbusRtu_StatsType stats;
+
+	ModbusRtu_getStats (&stats);
+	return ModbusCfg_saturate ((uint32)stats.maxLatency * MODBUS_RTU_TICK_US);
+}
+
+static uint16 ModbusCfg_readLateResponses (void)
+{
+	ModbusRtu_StatsType stats;
+
+	ModbusRtu_getStats (&stats);
+	return stats.lateResponses;
+}
+
+static uint16 ModbusCfg_readDroppedFrames (void)
+{
+	ModbusRtu_StatsType stats;
+
+	ModbusRtu_getStats (&stats);
+	return stats.droppedFrames;
+}
+
+static uint16 ModbusCfg_readNoise (void)
+{
+	return LM_35_getNoise ();
+}
+
+static uint16 ModbusCfg_readBootTime (void)
+{
+	return BootTime_getFirstPwmUs ();
+}
+
+static uint16 ModbusCfg_readAdcDuty (void)
+{
+	/* busy us / (ticks * SYS_TICK_PERIOD_MS * 1000 us) in 0.01 % */
+	uint32 ticks = SysTick_getTicks ();
+
+	if (ticks == 0)
+	{
+		return 0;
+	}
+	return ModbusCfg_saturate ((((ADC_getConversions () * ADC_getConversionTime ()) / ticks) * 10) / SYS_TICK_PERIOD_MS);
+}
+
+static uint16 ModbusCfg_readSampledShare (void)
+{
+	Sensor_StatsType stats;
+
+	Sensor_getStats (SENSOR_CONTROL_ID, &stats);
+	if (stats.samples == 0)
+	{
+		return 0;
+	}
+	return (uint16)((stats.samples * 100UL) / (stats.samples + stats.skips));
+}
+
+static uint16 ModbusCfg_readResetRecord (void)
+{
+	Watchdog_ResetInfoType info;
+
+	if (!Watchdog_getResetInfo (&info))
+	{
+		return 0;
+	}
+	return ((uint16)info.resetCount << 8) | info.missedTasks;
+}
+
+static uint16 ModbusCfg_readResetPeriod (void)
+{
+	Watchdog_ResetInfoType info;
+
+	if (!Watchdog_getResetInfo (&info))
+	{
+		return 0;
+	}
+	return ModbusCfg_saturate (WATCHDOG_TICKS_TO_US (info.worstPeriod));
+}
+
+static uint16 ModbusCfg_readMinSpeed (void)
+{
+	return FanControl_getMinSpeed ();
+}
+
+static void ModbusCfg_writeMinSpeed (uint16 value)
+{
+	FanControl_setMinSpeed ((uint8)value);
+}
+
+static uint16 ModbusCfg_readSetpoint (void)
+{
+	return FanControl_getSetpoint ();
+}
+
+static void ModbusCfg_writeSetpoint (uint16 value)
+{
+	FanControl_setSetpoint ((uint8)value);
+}
+
+static uint16 ModbusCfg_readAutotune (void)
+{
+	return (Autotune_getState () == AUTOTUNE_RUNNING);
+}
+
+static void ModbusCfg_writeAutotune (uint16 value)
+{
+	if (value != 0)
+	{
+		Autotune_start (FanControl_getSetpoint ());
+	}
+	else
+	{
+		Autotune_abort ();
+	}
+}
+
+static uint16 ModbusCfg_readPwmSync (void)
+{
+	return ADC_getPwmSync ();
+}
+
+static void ModbusCfg_writePwmSync (uint16 value)
+{
+	ADC_setPwmSync (value != 0);
+}
+
+static uint16 ModbusCfg_readFeedForwardEnable (void)
+{
+	return FanControl_getFeedForwardEnable ();
+}
+
+static void ModbusCfg_writeFeedForwardEnable (uint16 value)
+{
+	FanControl_setFeedForward (value != 0);
+}
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* The address of a register is its index, the layout is listed in modbus_cfg.h */
+const Modbus_RegisterType g_modbusInputRegisters[MODBUS_NUM_OF_INPUT_REGISTERS] = {
+	{ModbusCfg_readTemperature, NULL_PTR, 0, 0},
+	{ModbusCfg_readSensorStatus, NULL_PTR, 0, 0},
+	{ModbusCfg_readSpeed, NULL_PTR, 0, 0},
+	{ModbusCfg_readRpm, NULL_PTR, 0, 0},
+	{ModbusCfg_readFeedForward, NULL_PTR, 0, 0},
+	{ModbusCfg_readLoopPeriod, NULL_PTR, 0, 0},
+	{ModbusCfg_readLastLatency, NULL_PTR, 0, 0},
+	{ModbusCfg_readMaxLatency, NULL_PTR, 0, 0},
+	{ModbusCfg_readLateResponses, NULL_PTR, 0, 0},
+	{ModbusCfg_readDroppedFrames, NULL_PTR, 0, 0},
+	{ModbusCfg_readNoise, NULL_PTR, 0, 0},
+	{ModbusCfg_readBootTime, NULL_PTR, 0, 0},
+	{ModbusCfg_readAdcDuty, NULL_PTR, 0, 0},
+	{ModbusCfg_readSampledShare, NULL_PTR, 0, 0},
+	{ModbusCfg_readResetRecord, NULL_PTR, 0, 0},
+	{ModbusCfg_readResetPeriod, NULL_PTR, 0, 0}
+};
+
+const Modbus_RegisterType g_modbusHoldingRegisters[MODBUS_NUM_OF_HOLDING_REGISTERS] = {
+	{ModbusCfg_readMinSpeed, ModbusCfg_writeMinSpeed, 0, 100},
+	{ModbusCfg_readSetpoint, ModbusCfg_writeSetpoint, 20, 100},
+	{ModbusCfg_readAutotune, ModbusCfg_writeAutotune, 0, MODBUS_AUTOTUNE_MAX},
+	{ModbusCfg_readPwmSync, ModbusCfg_writePwmSync, 0, 1},
+	{ModbusCfg_readFeedForwardEnable, ModbusCfg_writeFeedForwardEnable, 0, 1}
+};
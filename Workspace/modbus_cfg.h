@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Module: MODBUS
+ *
+ * File Name: modbus_cfg.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the register map served by the Modbus slave
+ *
+ *******************************************************************************/
+
+#ifndef MODBUS_CFG_H_
+#define MODBUS_CFG_H_
+
+#include "modbus.h"
+#include "fan_control.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*
+ * Input registers (read only, 0x04):
+ *  0  control temperature, Q8.8 C (signed)
+ *  1  control sensor status (0 no data, 1 ok, 2 fault)
+ *  2  applied fan speed / PWM duty in percent
+ *  3  fan RPM, MODBUS_NOT_MEASURED as the board has no tachometer
+ *  4  feed-forward term in percent
+ *  5  worst loop period in microseconds (saturated)
+ *  6  last response latency in microseconds (saturated)
+ *  7  worst response latency in microseconds (saturated)
+ *  8  responses later than MODBUS_RESPONSE_TIMEOUT_MS
+ *  9  frames dropped (CRC, UART or length error)
+ * 10  LM35 noise, standard deviation of the last window of ADC codes in Q8.8 codes
+ * 11  time from the reset to the first PWM duty in microseconds
+ * 12  ADC duty cycle since the reset, share of the time spent converting in 0.01 %
+ * 13  loop iterations which sampled the control sensor in percent (adaptive sampling)
+ * 14  last deadline reset, consecutive resets in the high byte and the mask of the tasks
+ *     which missed in the low byte, 0 if the last reset was not a missed deadline
+ * 15  worst loop period before the last deadline reset in microseconds (saturated)
+ */
+#define MODBUS_NUM_OF_INPUT_REGISTERS            16
+
+/*
+ * Holding registers (read / write, 0x03, 0x06 and 0x10):
+ *  0  minimum fan speed in percent, 0 .. 100
+ *  1  PID and auto-tuning setpoint in Celsius, 20 .. 100
+ *  2  auto-tuning, write 1 to start around the setpoint and 0 to stop, reads 1 while it runs,
+ *     only 0 is accepted in the curve mode which does not use the tuned gains
+ *  3  ADC conversions started in the middle of the longer PWM phase, 0 .. 1
+ *  4  feed-forward term of the temperature rise added to the fan speed, 0 .. 1
+ */
+#define MODBUS_NUM_OF_HOLDING_REGISTERS          5
+
+#define MODBUS_NOT_MEASURED                      0xFFFF
+
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+#define MODBUS_AUTOTUNE_MAX                      1
+#else
+#define MODBUS_AUTOTUNE_MAX                      0
+#endif
+
+/*******************************************************************************
+ *                           External Variables                                *
+ *******************************************************************************/
+extern const Modbus_RegisterType g_modbusInputRegisters[MODBUS_NUM_OF_INPUT_REGISTERS];
+extern const Modbus_RegisterType g_modbusHoldingRegisters[MODBUS_NUM_OF_HOLDING_REGISTERS];
+
+#endif /* MODBUS_CFG_H_ */
@@ -0,0 +1,200 @@
+/******************************************************************************
+ *
+ * Module: MODBUS_RTU
+ *
+ * File Name: modbus_rtu.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the Modbus RTU framing of the slave on the USART,
+ *              with the inter-frame silence timed on Timer1 compare B
+ *
+ *******************************************************************************/
+
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include "modbus_rtu.h"
+#include "modbus.h"
+#include "timer.h"
+#include "lcd.h"
+
+#if ((MODBUS_RTU_ENABLE == 1) && (LCD_PIN_REMAP == 0))
+#error "The USART pins PD0/PD1 are taken by the LCD, set LCD_PIN_REMAP to 1"
+#endif
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	MODBUS_RTU_IDLE, MODBUS_RTU_RECEIVING, MODBUS_RTU_FRAME_READY, MODBUS_RTU_TRANSMITTING
+} ModbusRtu_StateType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* The request is received and the response built in place, one frame at a time */
+static uint8 g_frame[MODBUS_FRAME_SIZE];
+static volatile uint8 g_length = 0;
+static volatile uint16 g_crc = MODBUS_CRC_INIT;
+static volatile bool g_frameError = FALSE;
+static volatile uint16 g_lastByteTime = 0;
+static volatile ModbusRtu_StateType g_state = MODBUS_RTU_IDLE;
+
+static ModbusRtu_StatsType g_stats = {0, 0, 0, 0, 0, 0, 0};
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* Ready for the next request, the state is written last as it releases the receive interrupt */
+static void ModbusRtu_restart (void)
+{
+	g_length = 0;
+	g_crc = MODBUS_CRC_INIT;
+	g_frameError = FALSE;
+	g_state = MODBUS_RTU_IDLE;
+}
+
+/*
+ * Called from the receive interrupt: store the byte, update the CRC on the fly so the
+ * check costs nothing at the end of the frame, and restart the 3.5 characters timer.
+ */
+static void ModbusRtu_receiveByte (uint8 data, uint8 errors)
+{
+	uint16 now = Timer_getCount (TIMER1_ID);
+	uint8 length = g_length;
+
+	if ((g_state == MODBUS_RTU_FRAME_READY) || (g_state == MODBUS_RTU_TRANSMITTING))
+	{
+		return;
+	}
+	if ((errors != 0) || (length >= MODBUS_FRAME_SIZE))
+	{
+		g_frameError = TRUE;                   /* Keep receiving until the silence, then drop the frame */
+	}
+	else
+	{
+		g_frame[length] = data;
+		g_length = (uint8)(length + 1);
+		g_crc = Modbus_crcUpdate (g_crc, data);
+	}
+	g_state = MODBUS_RTU_RECEIVING;
+	g_lastByteTime = now;
+	Timer_setCompare (TIMER1_ID, TIMER_CHANNEL_B, (uint16)(now + MODBUS_RTU_T35_TICKS));
+	Timer_enableInterrupt (TIMER1_ID, TIMER_EVENT_COMPARE_B);
+}
+
+/* Called from the Timer1 compare B interrupt after 3.5 characters of silence */
+static void ModbusRtu_frameEnd (void)
+{
+	Timer_disableInterrupt (TIMER1_ID, TIMER_EVENT_COMPARE_B);
+	g_state = MODBUS_RTU_FRAME_READY;
+}
+
+/* Called from the transmit complete interrupt */
+static void ModbusRtu_transmitDone (void)
+{
+#if (MODBUS_RTU_RS485 == 1)
+	GPIO_writePin (MODBUS_RTU_DE_PORT, MODBUS_RTU_DE_PIN, LOGIC_LOW);
+#endif
+	ModbusRtu_restart ();
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * 1. Setup the USART with the RTU frame format and the RS-485 driver enable pin.
+ * 2. Hook the receive interrupt and the Timer1 compare B interrupt which detects
+ *    the end of a frame, Timer1 must already run (Watchdog_init).
+ */
+void ModbusRtu_init (void)
+{
+	UART_ConfigType s_configuration = {MODBUS_RTU_BAUD_RATE, MODBUS_RTU_PARITY, MODBUS_RTU_STOP_BITS};
+
+#if (MODBUS_RTU_RS485 == 1)
+	GPIO_setupPinDirection (MODBUS_RTU_DE_PORT, MODBUS_RTU_DE_PIN, PIN_OUTPUT);
+	GPIO_writePin (MODBUS_RTU_DE_PORT, MODBUS_RTU_DE_PIN, LOGIC_LOW);    /* Listen to the bus */
+#endif
+	ModbusRtu_restart ();
+	Timer_setCallBack (TIMER1_ID, TIMER_EVENT_COMPARE_B, ModbusRtu_frameEnd);
+	UART_setRxCallBack (ModbusRtu_receiveByte);
+	UART_setTxDoneCallBack (ModbusRtu_transmitDone);
+	UART_init (&s_configuration);
+}
+
+/*
+ * Description :
+ * Called every loop iteration: once a complete frame was received, check its CRC,
+ * execute it with Modbus_handleFrame and start sending the response.
+ * The bytes received while a frame waits or a response is sent are dropped.
+ */
+void ModbusRtu_step (void)
+{
+	uint8 length;
+	uint16 latency;
+
+	if (g_state != MODBUS_RTU_FRAME_READY)
+	{
+		return;
+	}
+
+	/* The CRC of an intact frame including its own CRC bytes is zero */
+	length = g_length;
+	if (g_frameError || (length < 2 + MODBUS_CRC_SIZE) || (g_crc != 0))
+	{
+		g_stats.droppedFrames++;
+		ModbusRtu_restart ();
+		return;
+	}
+	g_stats.frames++;
+
+	length = Modbus_handleFrame (g_frame, (uint8)(length - MODBUS_CRC_SIZE));
+	if (length == 0)
+	{
+		ModbusRtu_restart ();                  /* Another slave or a broadcast */
+		return;
+	}
+	if (g_frame[1] & MODBUS_EXCEPTION_FLAG)
+	{
+		g_stats.exceptions++;
+	}
+	length = Modbus_appendCrc (g_frame, length);
+
+	/* Latency from the end of the request to the start of the response, Timer1 is shared with the interrupts */
+	ATOMIC_BLOCK (ATOMIC_RESTORESTATE)
+	{
+		latency = (uint16)(Timer_getCount (TIMER1_ID) - g_lastByteTime);
+	}
+	g_stats.lastLatency = latency;
+	if (latency > g_stats.maxLatency)
+	{
+		g_stats.maxLatency = latency;
+	}
+	if (latency > MODBUS_RTU_TIMEOUT_TICKS)
+	{
+		g_stats.lateResponses++;               /* The master has given up, the response is sent anyway */
+	}
+	g_stats.responses++;
+
+	g_state = MODBUS_RTU_TRANSMITTING;
+#if (MODBUS_RTU_RS485 == 1)
+	GPIO_writePin (MODBUS_RTU_DE_PORT, MODBUS_RTU_DE_PIN, LOGIC_HIGH);
+#endif
+	UART_send (g_frame, length);
+}
+
+/*
+ * Description :
+ * Copy the frame counters and the response latency measurements.
+ */
+void ModbusRtu_getStats (ModbusRtu_StatsType * Stats_Ptr)
+{
+	*Stats_Ptr = g_stats;
+}
@@ -0,0 +1,106 @@
+/******************************************************************************
+ *
+ * Module: MODBUS_RTU
+ *
+ * File Name: modbus_rtu.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the Modbus RTU framing of the slave on the USART,
+ *              with the inter-frame silence timed on Timer1 compare B
+ *
+ *******************************************************************************/
+
+#ifndef MODBUS_RTU_H_
+#define MODBUS_RTU_H_
+
+#include "std_types.h"
+#include "gpio.h"
+#include "uart.h"
+#include "watchdog.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*
+ * Static Configurations, 1 = run the slave on the USART (PD0/PD1). It needs the
+ * LCD_PIN_REMAP wiring of lcd.h, the Proteus wiring has the LCD RS on PD0.
+ */
+#define MODBUS_RTU_ENABLE                        0
+
+/* RTU characters are 11 bits: 8 data bits, even parity and 1 stop bit */
+#define MODBUS_RTU_BAUD_RATE                     9600UL
+#define MODBUS_RTU_PARITY                        UART_PARITY_EVEN
+#define MODBUS_RTU_STOP_BITS                     UART_ONE_STOP_BIT
+
+/* Driver enable of an RS-485 transceiver, high while the slave transmits */
+#define MODBUS_RTU_RS485                         1
+#define MODBUS_RTU_DE_PORT                       PORTB_ID
+#define MODBUS_RTU_DE_PIN                        PIN2_ID
+
+/* Response time budget, the response timeout of the masters on the bus */
+#define MODBUS_RTU_RESPONSE_TIMEOUT_MS           100
+
+/* Parameters Definitions, Timer1 runs free from the watchdog monitor */
+#define MODBUS_RTU_CHARACTER_BITS                11UL
+#define MODBUS_RTU_TICK_US                       WATCHDOG_TICK_US
+
+/* 3.5 characters of silence end a frame, fixed to 1750 us above 19200 baud by the specification */
+#define MODBUS_RTU_T35_US \
+	((MODBUS_RTU_BAUD_RATE > 19200UL) ? 1750UL : \
+	 ((35UL * MODBUS_RTU_CHARACTER_BITS * 1000000UL + 10UL * MODBUS_RTU_BAUD_RATE - 1) / (10UL * MODBUS_RTU_BAUD_RATE)))
+
+/* One tick more as the silence starts anywhere inside the current timer tick */
+#define MODBUS_RTU_T35_TICKS                     ((MODBUS_RTU_T35_US + MODBUS_RTU_TICK_US - 1) / MODBUS_RTU_TICK_US + 1)
+#define MODBUS_RTU_TIMEOUT_TICKS                 ((MODBUS_RTU_RESPONSE_TIMEOUT_MS * 1000UL) / MODBUS_RTU_TICK_US)
+
+#if (UART_BAUD_ERROR (MODBUS_RTU_BAUD_RATE) > 20)
+#error "The Modbus baud rate is more than 2% off with this F_CPU"
+#endif
+#if (MODBUS_RTU_TIMEOUT_TICKS > 0xFFFF)
+#error "The response timeout does not fit in the 16-bit Timer1"
+#endif
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	uint16 frames;                     /* Frames received with a valid CRC */
+	uint16 droppedFrames;              /* Frames with a CRC, UART or length error */
+	uint16 responses;
+	uint16 exceptions;                 /* Responses which were exceptions */
+	uint16 lateResponses;              /* Responses started after MODBUS_RTU_RESPONSE_TIMEOUT_MS */
+	uint16 lastLatency;                /* Last request end to response start in Timer1 ticks */
+	uint16 maxLatency;
+} ModbusRtu_StatsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * 1. Setup the USART with the RTU frame format and the RS-485 driver enable pin.
+ * 2. Hook the receive interrupt and the Timer1 compare B interrupt which detects
+ *    the end of a frame, Timer1 must already run (Watchdog_init).
+ */
+void ModbusRtu_init (void);
+
+/*
+ * Description :
+ * Called every loop iteration: once a complete frame was received, check its CRC,
+ * execute it with Modbus_handleFrame and start sending the response.
+ * The bytes received while a frame waits or a response is sent are dropped.
+ */
+void ModbusRtu_step (void);
+
+/*
+ * Description :
+ * Copy the frame counters and the response latency measurements.
+ */
+void ModbusRtu_getStats (ModbusRtu_StatsType * Stats_Ptr);
+
+#endif /* MODBUS_RTU_H_ */
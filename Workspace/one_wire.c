@@ -0,0 +1,187 @@
+/******************************************************************************
+ *
+ * Module: ONE_WIRE
+ *
+ * File Name: one_wire.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the 1-Wire bus master on a single GPIO pin.
+ *              Every bus operation is a short bounded burst, the slot timing
+ *              is kept with the interrupts disabled for one slot at a time.
+ *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/delay.h>
+#include "common_macros.h"
+#include "gpio.h"
+#include "one_wire.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* The pin is never driven high: low is output 0, released is input with the external pull-up */
+#ifdef __AVR__
+#define ONE_WIRE_DRIVE_LOW()                     SET_BIT (ONE_WIRE_DDR_REG, ONE_WIRE_PIN)
+#define ONE_WIRE_RELEASE()                       CLEAR_BIT (ONE_WIRE_DDR_REG, ONE_WIRE_PIN)
+#define ONE_WIRE_READ()                          GET_BIT (ONE_WIRE_PIN_REG, ONE_WIRE_PIN)
+#else
+/* Host build: every edge goes to the simulated devices, which need its exact time */
+#define ONE_WIRE_DRIVE_LOW()                     OneWire_hostDrive (TRUE)
+#define ONE_WIRE_RELEASE()                       OneWire_hostDrive (FALSE)
+#define ONE_WIRE_READ()                          OneWire_hostRead ()
+#endif
+
+/*
+ * The slots are timed in CPU cycles: a cycle exact busy wait does not depend on the
+ * optimization level, while <util/delay.h> computes its loop count in float at -O0.
+ * The timers cannot time the slots, their compare units are all taken.
+ */
+#ifdef __AVR__
+#define ONE_WIRE_DELAY_US(US)                    __builtin_avr_delay_cycles ((uint32)(US) * (F_CPU / 1000000UL))
+#else
+#define ONE_WIRE_DELAY_US(US)                    _delay_us (US)
+#endif
+
+/* Slot timings in us from the DS18B20 datasheet */
+#define ONE_WIRE_RESET_LOW_US                    480
+#define ONE_WIRE_PRESENCE_SAMPLE_US              70
+#define ONE_WIRE_RESET_RECOVERY_US               410
+#define ONE_WIRE_SLOT_US                         60
+#define ONE_WIRE_READ_SAMPLE_US                  9        /* Plus the 2 us low pulse and the read, sampled at about 12 us of the 15 us window */
+#define ONE_WIRE_RECOVERY_US                     3
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void OneWire_writeBit (uint8 bit)
+{
+	cli();
+	ONE_WIRE_DRIVE_LOW();
+	if (bit)
+	{
+		/* Write 1: release within 15 us and let the pull-up hold the rest of the slot */
+		ONE_WIRE_RELEASE();
+		sei();
+		ONE_WIRE_DELAY_US (ONE_WIRE_SLOT_US);
+	}
+	else
+	{
+		/* Write 0: hold the bus low for the whole slot */
+		ONE_WIRE_DELAY_US (ONE_WIRE_SLOT_US);
+		ONE_WIRE_RELEASE();
+		sei();
+	}
+	ONE_WIRE_DELAY_US (ONE_WIRE_RECOVERY_US);
+}
+
+static uint8 OneWire_readBit (void)
+{
+	uint8 bit;
+
+	cli();
+	ONE_WIRE_DRIVE_LOW();
+	ONE_WIRE_RELEASE();
+	ONE_WIRE_DELAY_US (ONE_WIRE_READ_SAMPLE_US);
+	bit = ONE_WIRE_READ();
+	sei();
+	ONE_WIRE_DELAY_US (ONE_WIRE_SLOT_US);
+	return bit;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Release the bus pin (input without the internal pull-up).
+ */
+void OneWire_init (void)
+{
+	CLEAR_BIT (ONE_WIRE_PORT_REG, ONE_WIRE_PIN);   /* Output value 0 whenever the pin is driven */
+	ONE_WIRE_RELEASE();
+}
+
+/*
+ * Description :
+ * Send the reset pulse and sample the presence pulse, takes about 1 ms.
+ * Returns TRUE if at least one device answered.
+ */
+bool OneWire_reset (void)
+{
+	uint8 presence;
+
+	ONE_WIRE_DRIVE_LOW();
+	ONE_WIRE_DELAY_US (ONE_WIRE_RESET_LOW_US);
+
+	cli();
+	ONE_WIRE_RELEASE();
+	ONE_WIRE_DELAY_US (ONE_WIRE_PRESENCE_SAMPLE_US);
+	presence = !ONE_WIRE_READ();               /* The devices pull the bus low to answer */
+	sei();
+
+	ONE_WIRE_DELAY_US (ONE_WIRE_RESET_RECOVERY_US);
+	return presence ? TRUE : FALSE;
+}
+
+/*
+ * Description :
+ * Write one byte LSB first, takes about 0.6 ms.
+ */
+void OneWire_writeByte (uint8 data)
+{
+	uint8 i;
+
+	for (i = 0; i < 8; i++)
+	{
+		OneWire_writeBit (GET_BIT (data, i));
+	}
+}
+
+/*
+ * Description :
+ * Read one byte LSB first, takes about 0.6 ms.
+ */
+uint8 OneWire_readByte (void)
+{
+	uint8 data = 0;
+	uint8 i;
+
+	for (i = 0; i < 8; i++)
+	{
+		if (OneWire_readBit ())
+		{
+			SET_BIT (data, i);
+		}
+	}
+	return data;
+}
+
+/*
+ * Description :
+ * Update the Dallas/Maxim CRC-8 (polynomial x^8 + x^5 + x^4 + 1) with one byte.
+ */
+uint8 OneWire_crc8 (uint8 crc, uint8 data)
+{
+	uint8 i;
+
+	for (i = 0; i < 8; i++)
+	{
+		if ((crc ^ data) & 0x01)
+		{
+			crc = (crc >> 1) ^ 0x8C;
+		}
+		else
+		{
+			crc >>= 1;
+		}
+		data >>= 1;
+	}
+	return crc;
+}
@@ -0,0 +1,84 @@
+/******************************************************************************
+ *
+ * Module: ONE_WIRE
+ *
+ * File Name: one_wire.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the 1-Wire bus master on a single GPIO pin.
+ *              Every bus operation is a short bounded burst, the slot timing
+ *              is kept with the interrupts disabled for one slot at a time.
+ *
+ *******************************************************************************/
+
+#ifndef ONE_WIRE_H_
+#define ONE_WIRE_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*
+ * Static Configurations, the bus pin is accessed through its registers as a GPIO
+ * driver call at 1 MHz is longer than the 15 us read slot window.
+ * The bus needs an external 4.7K pull-up resistor.
+ */
+#define ONE_WIRE_PORT_REG                        PORTD
+#define ONE_WIRE_DDR_REG                         DDRD
+#define ONE_WIRE_PIN_REG                         PIND
+#define ONE_WIRE_PIN                             PIN7_ID
+
+/* ROM commands */
+#define ONE_WIRE_SKIP_ROM                        0xCC
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+#ifndef __AVR__
+/*
+ * Description :
+ * Pin access of the host build, provided by the simulated bus (Host/bus_sim.c):
+ * drive the bus low or release it, and read the level of the bus.
+ */
+void OneWire_hostDrive (bool low);
+uint8 OneWire_hostRead (void);
+#endif
+
+/*
+ * Description :
+ * Release the bus pin (input without the internal pull-up).
+ */
+void OneWire_init (void);
+
+/*
+ * Description :
+ * Send the reset pulse and sample the presence pulse, takes about 1 ms.
+ * Returns TRUE if at least one device answered.
+ */
+bool OneWire_reset (void);
+
+/*
+ * Description :
+ * Write one byte LSB first, takes about 0.6 ms.
+ */
+void OneWire_writeByte (uint8 data);
+
+/*
+ * Description :
+ * Read one byte LSB first, takes about 0.6 ms.
+ */
+uint8 OneWire_readByte (void);
+
+/*
+ * Description :
+ * Update the Dallas/Maxim CRC-8 (polynomial x^8 + x^5 + x^4 + 1) with one byte.
+ */
+uint8 OneWire_crc8 (uint8 crc, uint8 data);
+
+#endif /* ONE_WIRE_H_ */
@@ -0,0 +1,85 @@
+/******************************************************************************
+ *
+ * Module: PID
+ *
+ * File Name: pid_controller.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the integer PID controller of the fan speed
+ *
+ *******************************************************************************/
+
+#include "pid_controller.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define PID_OUTPUT_MAX_FIXED                     ((sint32)PID_OUTPUT_MAX << PID_GAIN_SHIFT)
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Initialize the controller with the required gains and setpoint and clear its history.
+ */
+void Pid_init (Pid_ControllerType * Pid_Ptr, const Pid_GainsType * Gains_Ptr, sint16 setpoint)
+{
+	Pid_Ptr -> gains = *Gains_Ptr;
+	Pid_Ptr -> setpoint = setpoint;
+	Pid_Ptr -> integral = 0;
+	Pid_Ptr -> lastError = 0;
+	Pid_Ptr -> firstUpdate = TRUE;
+
+	/* The integral term alone never needs to exceed the full output, this also keeps ki * integral in 32 bits */
+	Pid_Ptr -> integralLimit = (Gains_Ptr -> ki > 0) ? (PID_OUTPUT_MAX_FIXED / Gains_Ptr -> ki) : 0;
+}
+
+/*
+ * Description :
+ * Run one controller update with the measured temperature and return the
+ * fan speed in percent (0 .. PID_OUTPUT_MAX). The integral is only accumulated
+ * while the output is not saturated in the direction of the error (anti-windup).
+ */
+uint8 Pid_update (Pid_ControllerType * Pid_Ptr, sint16 measurement)
+{
+	sint16 error = measurement - Pid_Ptr -> setpoint;
+	sint16 derivative = Pid_Ptr -> firstUpdate ? 0 : (error - Pid_Ptr -> lastError);
+	sint32 integral = Pid_Ptr -> integral + error;
+	sint32 output;
+
+	if (integral > Pid_Ptr -> integralLimit)
+	{
+		integral = Pid_Ptr -> integralLimit;
+	}
+	else if (integral < -Pid_Ptr -> integralLimit)
+	{
+		integral = -Pid_Ptr -> integralLimit;
+	}
+
+	output = (Pid_Ptr -> gains.kp * error) + (Pid_Ptr -> gains.ki * integral) + (Pid_Ptr -> gains.kd * derivative);
+
+	/* Conditional integration: keep the new integral only if it does not push further into saturation */
+	if (!(((output > PID_OUTPUT_MAX_FIXED) && (error > 0)) || ((output < 0) && (error < 0))))
+	{
+		Pid_Ptr -> integral = integral;
+	}
+	Pid_Ptr -> lastError = error;
+	Pid_Ptr -> firstUpdate = FALSE;
+
+	if (output <= 0)
+	{
+		return 0;
+	}
+	if (output >= PID_OUTPUT_MAX_FIXED)
+	{
+		return PID_OUTPUT_MAX;
+	}
+	/* Round to the nearest percent */
+	return (uint8)Fixed_round (output, PID_GAIN_SHIFT);
+}
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *
+ * Module: PID
+ *
+ * File Name: pid_controller.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the integer PID controller of the fan speed
+ *
+ *******************************************************************************/
+
+#ifndef PID_CONTROLLER_H_
+#define PID_CONTROLLER_H_
+
+#include "std_types.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations, the gains are per update so the controller runs on this fixed period */
+#define PID_PERIOD_MS                            100
+
+/* Parameters Definitions */
+#define PID_GAIN_SHIFT                           FIXED_Q16_16_SHIFT
+#define PID_GAIN(VALUE)                          FIXED_Q16_16(VALUE)
+#define PID_OUTPUT_MAX                           100
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/*
+ * The gains are Q16.16 fixed point values (use PID_GAIN(x) to build them) per
+ * controller update, the output is the fan speed in percent:
+ *   speed = kp * e + ki * sum(e) + kd * (e - e_previous), e = temperature - setpoint
+ */
+typedef struct{
+	sint32 kp;
+	sint32 ki;
+	sint32 kd;
+} Pid_GainsType;
+
+typedef struct{
+	Pid_GainsType gains;
+	sint16 setpoint;                   /* Celsius */
+	sint32 integral;                   /* Sum of the errors, clamped against windup */
+	sint32 integralLimit;
+	sint16 lastError;
+	bool firstUpdate;
+} Pid_ControllerType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Initialize the controller with the required gains and setpoint and clear its history.
+ */
+void Pid_init (Pid_ControllerType * Pid_Ptr, const Pid_GainsType * Gains_Ptr, sint16 setpoint);
+
+/*
+ * Description :
+ * Run one controller update with the measured temperature and return the
+ * fan speed in percent (0 .. PID_OUTPUT_MAX). The integral is only accumulated
+ * while the output is not saturated in the direction of the error (anti-windup).
+ */
+uint8 Pid_update (Pid_ControllerType * Pid_Ptr, sint16 measurement);
+
+#endif /* PID_CONTROLLER_H_ */
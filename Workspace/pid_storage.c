@@ -0,0 +1,102 @@
+/******************************************************************************
+ *
+ * Module: PID_STORAGE
+ *
+ * File Name: pid_storage.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the EEPROM copy of the tuned PID gains
+ *
+ *******************************************************************************/
+
+#include <avr/eeprom.h>
+#include "pid_storage.h"
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	uint16 magic;
+	Pid_GainsType gains;
+	uint8 checksum;                    /* Two's complement of the sum of the previous bytes */
+} PidStorage_RecordType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static PidStorage_RecordType g_record EEMEM;
+
+/* Record waiting to be written and the index of its next byte, sizeof(record) when done */
+static PidStorage_RecordType g_pendingRecord;
+static uint8 g_pendingIndex = sizeof(PidStorage_RecordType);
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static uint8 PidStorage_checksum (const PidStorage_RecordType * Record_Ptr)
+{
+	const uint8 * bytes = (const uint8 *)Record_Ptr;
+	uint8 sum = 0;
+	uint8 i;
+
+	for (i = 0; i < sizeof(PidStorage_RecordType) - 1; i++)
+	{
+		sum += bytes[i];
+	}
+	return (uint8)(-sum);
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Queue the gains with a magic value and a checksum for writing to the EEPROM,
+ * the bytes are then programmed by PidStorage_step.
+ */
+void PidStorage_save (const Pid_GainsType * Gains_Ptr)
+{
+	g_pendingRecord.magic = PID_STORAGE_MAGIC;
+	g_pendingRecord.gains = *Gains_Ptr;
+	g_pendingRecord.checksum = PidStorage_checksum (&g_pendingRecord);
+	g_pendingIndex = 0;
+}
+
+/*
+ * Description :
+ * Called every loop iteration: once the EEPROM is ready, program the next queued
+ * byte if it differs from the stored one. Never waits for the 8.5 ms write cycle.
+ */
+void PidStorage_step (void)
+{
+	if ((g_pendingIndex >= sizeof(PidStorage_RecordType)) || (!eeprom_is_ready ()))
+	{
+		return;
+	}
+
+	/* A reset in the middle leaves a partial record, which the checksum rejects at the next load */
+	eeprom_update_byte ((uint8 *)&g_record + g_pendingIndex, ((const uint8 *)&g_pendingRecord)[g_pendingIndex]);
+	g_pendingIndex++;
+}
+
+/*
+ * Description :
+ * Read the gains stored in the EEPROM.
+ * Returns FALSE if the EEPROM holds no valid gains (never written or corrupted).
+ */
+bool PidStorage_load (Pid_GainsType * Gains_Ptr)
+{
+	PidStorage_RecordType record;
+
+	eeprom_read_block (&record, &g_record, sizeof(record));
+	if ((record.magic != PID_STORAGE_MAGIC) || (record.checksum != PidStorage_checksum (&record)))
+	{
+		return FALSE;
+	}
+	*Gains_Ptr = record.gains;
+	return TRUE;
+}
@@ -0,0 +1,53 @@
+/******************************************************************************
+ *
+ * Module: PID_STORAGE
+ *
+ * File Name: pid_storage.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the EEPROM copy of the tuned PID gains
+ *
+ *******************************************************************************/
+
+#ifndef PID_STORAGE_H_
+#define PID_STORAGE_H_
+
+#include "std_types.h"
+#include "pid_controller.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Parameters Definitions, change the magic when the stored layout changes */
+#define PID_STORAGE_MAGIC                        0xA55A
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Queue the gains with a magic value and a checksum for writing to the EEPROM,
+ * the bytes are then programmed by PidStorage_step.
+ */
+void PidStorage_save (const Pid_GainsType * Gains_Ptr);
+
+/*
+ * Description :
+ * Called every loop iteration: once the EEPROM is ready, program the next queued
+ * byte if it differs from the stored one. Never waits for the 8.5 ms write cycle.
+ */
+void PidStorage_step (void);
+
+/*
+ * Description :
+ * Read the gains stored in the EEPROM.
+ * Returns FALSE if the EEPROM holds no valid gains (never written or corrupted).
+ */
+bool PidStorage_load (Pid_GainsType * Gains_Ptr);
+
+#endif /* PID_STORAGE_H_ */
@@ -5,11 +5,48 @@
  *      Author: Mohamed
  */
 
-#include <avr/io.h>
-#include <math.h>
-#include "common_macros.h"
 #include "pwm_timer0.h"
-#include "gpio.h"
+#include "timer.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Fast PWM, F_CPU/8 and clear OC0 on compare match (non inverted mode) */
+static const Timer_ConfigType g_timerConfig = {
+	TIMER_FAST_PWM_MODE, TIMER_F_CPU_8, 0, {0, 0}, {TIMER_OUTPUT_CLEAR, TIMER_OUTPUT_DISCONNECTED},
+	0, TIMER_CAPTURE_FALLING
+};
+
+static bool g_started = FALSE;
+
+#if (PWM_TIMER0_DITHER == 1)
+/* Whole compare value and fraction of the fine duty, shared with the overflow interrupt */
+static volatile uint8 g_ditherBase = 0;
+static volatile uint8 g_ditherFraction = 0;
+static uint8 g_ditherAccumulator = 0;
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+#if (PWM_TIMER0_DITHER == 1)
+/*
+ * Called on every Timer0 overflow while the duty has a fraction. The fraction is added
+ * to an 8-bit accumulator and each carry out raises the next period by one count, so
+ * over 256 periods OCR0 is base + 1 exactly fraction times. OCR0 is double buffered
+ * in fast PWM, the value written here takes effect from the next period on.
+ */
+static void PWM_Timer0_dither (void)
+{
+	uint8 sum = g_ditherAccumulator + g_ditherFraction;
+
+	Timer_setCompare (TIMER0_ID, TIMER_CHANNEL_A, (sum < g_ditherAccumulator) ? (g_ditherBase + 1) : g_ditherBase);
+	g_ditherAccumulator = sum;
+}
+#endif
 
 /*******************************************************************************
  *                      Functions Definitions                                  *
@@ -21,16 +58,46 @@
  *3. Setup the compare value based on the required input duty cycle
  *4. Setup the direction for OC0 as output pin through the GPIO driver.
  *5. The generated PWM signal frequency will be 500Hz to control the DC Motor speed.
+ *The timer is configured through the timer driver on the first call only, the next
+ *calls just update the compare value without restarting the PWM period.
  */
 void PWM_Timer0_start(uint8 duty_cycle)
 {
-	TCNT0 = 0;                       /* Set timer register initial value to 0 */
-	/* Fast PWM Mode WGM01 = 1 & WGM00 = 1 */
-	SET_BIT (TCCR0, WGM00);
-	SET_BIT (TCCR0, WGM01);
-
-	SET_BIT (TCCR0, COM01);          /* Clear OC0 when match occurs (non inverted mode) COM00 = 0 & COM01 = 1 */
-	SET_BIT (TCCR0, CS01);           /* Clock = F_CPU/8 by making CS00 = 0, CS01 = 1, CS02 = 0 */
-	OCR0 = ceil ((duty_cycle / 100.0) * TIMER0_TOP_VALUE);    /* Set compare value */
-	GPIO_setupPinDirection (PORTB_ID, PIN3_ID, PIN_OUTPUT);   /* Configure PB3/OC0 as output pin */
+	PWM_Timer0_setDuty ((uint16)Fixed_scaleRound (duty_cycle, PWM_TIMER0_DUTY_MAX, 100));
+}
+
+/* Description :
+ *Same as PWM_Timer0_start with a fine duty: the compare value in 1/256 of a timer
+ *count, 0 to PWM_TIMER0_DUTY_MAX. With PWM_TIMER0_DITHER the fraction is spread over
+ *the PWM periods by a first-order sigma-delta in the Timer0 overflow interrupt, so the
+ *average duty has 16 bits of resolution. Without it the duty rounds to a whole count.
+ */
+void PWM_Timer0_setDuty(uint16 duty)
+{
+	if (duty > PWM_TIMER0_DUTY_MAX)
+	{
+		duty = PWM_TIMER0_DUTY_MAX;
+	}
+	if (!g_started)
+	{
+		Timer_init (TIMER0_ID, &g_timerConfig);
+#if (PWM_TIMER0_DITHER == 1)
+		Timer_setCallBack (TIMER0_ID, TIMER_EVENT_OVERFLOW, PWM_Timer0_dither);
+#endif
+		g_started = TRUE;
+	}
+
+#if (PWM_TIMER0_DITHER == 1)
+	/* The interrupt is off during the update, and a whole duty needs no interrupt at all */
+	Timer_disableInterrupt (TIMER0_ID, TIMER_EVENT_OVERFLOW);
+	g_ditherBase = (uint8)(duty >> PWM_TIMER0_FRACTION_BITS);
+	g_ditherFraction = (uint8)duty;
+	Timer_setCompare (TIMER0_ID, TIMER_CHANNEL_A, g_ditherBase);
+	if (g_ditherFraction != 0)
+	{
+		Timer_enableInterrupt (TIMER0_ID, TIMER_EVENT_OVERFLOW);
+	}
+#else
+	Timer_setCompare (TIMER0_ID, TIMER_CHANNEL_A, (duty + (1 << (PWM_TIMER0_FRACTION_BITS - 1))) >> PWM_TIMER0_FRACTION_BITS);
+#endif
 }
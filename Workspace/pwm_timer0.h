@@ -14,8 +14,13 @@
  *                                Definitions                                  *
  *******************************************************************************/
 
+/* Static Configurations */
+#define PWM_TIMER0_DITHER           1           /* 1 to dither OCR0 between adjacent values for a fine average duty */
+
 /* Parameters Definitions */
 #define TIMER0_TOP_VALUE            255
+#define PWM_TIMER0_FRACTION_BITS    8
+#define PWM_TIMER0_DUTY_MAX         ((uint16)TIMER0_TOP_VALUE << PWM_TIMER0_FRACTION_BITS)    /* 100 % fine duty */
 
 /*******************************************************************************
  *                      Functions Prototypes                                   *
@@ -27,7 +32,17 @@
  *3. Setup the compare value based on the required input duty cycle
  *4. Setup the direction for OC0 as output pin through the GPIO driver.
  *5. The generated PWM signal frequency will be 500Hz to control the DC Motor speed.
+ *The timer is configured through the timer driver on the first call only, the next
+ *calls just update the compare value without restarting the PWM period.
  */
 void PWM_Timer0_start(uint8 duty_cycle);
 
+/* Description :
+ *Same as PWM_Timer0_start with a fine duty: the compare value in 1/256 of a timer
+ *count, 0 to PWM_TIMER0_DUTY_MAX. With PWM_TIMER0_DITHER the fraction is spread over
+ *the PWM periods by a first-order sigma-delta in the Timer0 overflow interrupt, so the
+ *average duty has 16 bits of resolution. Without it the duty rounds to a whole count.
+ */
+void PWM_Timer0_setDuty(uint16 duty);
+
 #endif /* PWM_TIMER0_H_ */
@@ -0,0 +1,155 @@
+/******************************************************************************
+ *
+ * Module: RING_BUFFER
+ *
+ * File Name: ring_buffer.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the lock-free single-producer / single-consumer byte ring buffer
+ *
+ *******************************************************************************/
+
+#include "ring_buffer.h"
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Attach the storage of the given size to the ring buffer and empty it, call it
+ * before the producer and the consumer start.
+ * Returns FALSE if the size is not a power of two from 2 to RING_BUFFER_MAX_SIZE.
+ */
+bool RingBuffer_init (RingBuffer_Type * Ring_Ptr, uint8 * Data_Ptr, uint8 size)
+{
+	if ((Data_Ptr == NULL_PTR) || !RING_BUFFER_SIZE_IS_VALID (size))
+	{
+		return FALSE;
+	}
+	Ring_Ptr -> data = Data_Ptr;
+	Ring_Ptr -> mask = (uint8)(size - 1);
+	Ring_Ptr -> head = 0;
+	Ring_Ptr -> tail = 0;
+	Ring_Ptr -> overflows = 0;
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Producer side: append one byte.
+ * Returns FALSE and counts an overflow if the buffer is full.
+ */
+bool RingBuffer_push (RingBuffer_Type * Ring_Ptr, uint8 byte)
+{
+	uint8 head = Ring_Ptr -> head;
+
+	if ((uint8)(head - Ring_Ptr -> tail) > Ring_Ptr -> mask)
+	{
+		Ring_Ptr -> overflows++;               /* The consumer is too slow, keep the older bytes */
+		return FALSE;
+	}
+	Ring_Ptr -> data[head & Ring_Ptr -> mask] = byte;
+	RING_BUFFER_BARRIER ();                    /* The byte must be stored before the consumer can see it */
+	Ring_Ptr -> head = (uint8)(head + 1);
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Producer side: append the given bytes as one block, all of them or none, so the
+ * consumer never sees a partial record.
+ * Returns FALSE and counts an overflow if they do not fit.
+ */
+bool RingBuffer_pushBulk (RingBuffer_Type * Ring_Ptr, const uint8 * Data_Ptr, uint8 length)
+{
+	uint8 head = Ring_Ptr -> head;
+	uint8 i;
+
+	if ((uint16)(uint8)(head - Ring_Ptr -> tail) + length > (uint16)Ring_Ptr -> mask + 1)
+	{
+		Ring_Ptr -> overflows++;
+		return FALSE;
+	}
+	for (i = 0; i < length; i++)
+	{
+		Ring_Ptr -> data[(uint8)(head + i) & Ring_Ptr -> mask] = Data_Ptr[i];
+	}
+	RING_BUFFER_BARRIER ();
+	Ring_Ptr -> head = (uint8)(head + length);   /* One index store publishes the whole block */
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Consumer side: take the oldest byte.
+ * Returns FALSE if the buffer is empty.
+ */
+bool RingBuffer_pop (RingBuffer_Type * Ring_Ptr, uint8 * Byte_Ptr)
+{
+	uint8 tail = Ring_Ptr -> tail;
+
+	if (tail == Ring_Ptr -> head)
+	{
+		return FALSE;
+	}
+	RING_BUFFER_BARRIER ();                    /* Read the byte only after seeing the head that published it */
+	*Byte_Ptr = Ring_Ptr -> data[tail & Ring_Ptr -> mask];
+	RING_BUFFER_BARRIER ();                    /* The byte must be read before the producer can reuse its slot */
+	Ring_Ptr -> tail = (uint8)(tail + 1);
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Consumer side: take up to the given number of the oldest bytes.
+ * Returns the number of bytes copied.
+ */
+uint8 RingBuffer_popBulk (RingBuffer_Type * Ring_Ptr, uint8 * Data_Ptr, uint8 length)
+{
+	uint8 tail = Ring_Ptr -> tail;
+	uint8 count = (uint8)(Ring_Ptr -> head - tail);
+	uint8 i;
+
+	if (length > count)
+	{
+		length = count;
+	}
+	RING_BUFFER_BARRIER ();
+	for (i = 0; i < length; i++)
+	{
+		Data_Ptr[i] = Ring_Ptr -> data[(uint8)(tail + i) & Ring_Ptr -> mask];
+	}
+	RING_BUFFER_BARRIER ();
+	Ring_Ptr -> tail = (uint8)(tail + length);
+	return length;
+}
+
+/*
+ * Description :
+ * Return the number of waiting bytes. The other side can change it right after the
+ * read: the consumer only sees it grow and the producer only sees it shrink.
+ */
+uint8 RingBuffer_getCount (const RingBuffer_Type * Ring_Ptr)
+{
+	return (uint8)(Ring_Ptr -> head - Ring_Ptr -> tail);
+}
+
+/*
+ * Description :
+ * Return the number of pushes rejected since the initialization, from either side.
+ */
+uint16 RingBuffer_getOverflows (const RingBuffer_Type * Ring_Ptr)
+{
+	uint16 overflows;
+
+	/* The two bytes are read apart, read again if the producer counted in between */
+	do
+	{
+		overflows = Ring_Ptr -> overflows;
+	} while (overflows != Ring_Ptr -> overflows);
+	return overflows;
+}
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *
+ * Module: RING_BUFFER
+ *
+ * File Name: ring_buffer.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the lock-free single-producer / single-consumer byte ring buffer
+ *
+ *******************************************************************************/
+
+#ifndef RING_BUFFER_H_
+#define RING_BUFFER_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Parameters Definitions */
+#define RING_BUFFER_MAX_SIZE                     128        /* The 8-bit free running indexes count up to the size */
+#define RING_BUFFER_SIZE_IS_VALID(SIZE)          (((SIZE) >= 2) && ((SIZE) <= RING_BUFFER_MAX_SIZE) && (((SIZE) & ((SIZE) - 1)) == 0))
+
+/*
+ * Orders the data accesses against the index updates. The AVR has one core so keeping
+ * the compiler from moving them is enough, the host build (threads) needs a full fence.
+ */
+#ifdef __AVR__
+#define RING_BUFFER_BARRIER()                    __asm__ __volatile__ ("" ::: "memory")
+#else
+#define RING_BUFFER_BARRIER()                    __sync_synchronize ()
+#endif
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/*
+ * One side (e.g. an interrupt) only pushes and the other (e.g. the main loop) only pops.
+ * Each index is a single byte written by one side only, so neither side disables the
+ * interrupts: head - tail is the number of waiting bytes, from 0 up to the full size.
+ */
+typedef struct{
+	uint8 * data;
+	uint8 mask;                        /* Size - 1, the size is a power of two */
+	volatile uint8 head;               /* Bytes pushed so far (mod 256), producer only */
+	volatile uint8 tail;               /* Bytes popped so far (mod 256), consumer only */
+	volatile uint16 overflows;         /* Pushes rejected as the buffer was full, producer only */
+} RingBuffer_Type;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Attach the storage of the given size to the ring buffer and empty it, call it
+ * before the producer and the consumer start.
+ * Returns FALSE if the size is not a power of two from 2 to RING_BUFFER_MAX_SIZE.
+ */
+bool RingBuffer_init (RingBuffer_Type * Ring_Ptr, uint8 * Data_Ptr, uint8 size);
+
+/*
+ * Description :
+ * Producer side: append one byte.
+ * Returns FALSE and counts an overflow if the buffer is full.
+ */
+bool RingBuffer_push (RingBuffer_Type * Ring_Ptr, uint8 byte);
+
+/*
+ * Description :
+ * Producer side: append the given bytes as one block, all of them or none, so the
+ * consumer never sees a partial record.
+ * Returns FALSE and counts an overflow if they do not fit.
+ */
+bool RingBuffer_pushBulk (RingBuffer_Type * Ring_Ptr, const uint8 * Data_Ptr, uint8 length);
+
+/*
+ * Description :
+ * Consumer side: take the oldest byte.
+ * Returns FALSE if the buffer is empty.
+ */
+bool RingBuffer_pop (RingBuffer_Type * Ring_Ptr, uint8 * Byte_Ptr);
+
+/*
+ * Description :
+ * Consumer side: take up to the given number of the oldest bytes.
+ * Returns the number of bytes copied.
+ */
+uint8 RingBuffer_popBulk (RingBuffer_Type * Ring_Ptr, uint8 * Data_Ptr, uint8 length);
+
+/*
+ * Description :
+ * Return the number of waiting bytes. The other side can change it right after the
+ * read: the consumer only sees it grow and the producer only sees it shrink.
+ */
+uint8 RingBuffer_getCount (const RingBuffer_Type * Ring_Ptr);
+
+/*
+ * Description :
+ * Return the number of pushes rejected since the initialization, from either side.
+ */
+uint16 RingBuffer_getOverflows (const RingBuffer_Type * Ring_Ptr);
+
+#endif /* RING_BUFFER_H_ */
@@ -0,0 +1,256 @@
+/******************************************************************************
+ *
+ * Module: SENSOR
+ *
+ * File Name: sensor.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the temperature sensor abstraction. Every sensor
+ *              type implements the same interface table and every configured
+ *              sensor instance gets its own fixed-point calibration.
+ *
+ *******************************************************************************/
+
+#include "sensor.h"
+#include "sensor_cfg.h"
+#include "adc.h"
+#include "sys_tick.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static sint16 g_temperatures[SENSOR_NUM_OF_SENSORS];
+static Sensor_StatusType g_statuses[SENSOR_NUM_OF_SENSORS];
+static Sensor_StatsType g_stats[SENSOR_NUM_OF_SENSORS];
+
+#if (SENSOR_ADAPTIVE_SAMPLING == 1)
+/* Sampling state of every sensor, a sensor starts fast until its temperature proves steady */
+static uint32 g_nextSampleTicks[SENSOR_NUM_OF_SENSORS];
+static uint8 g_calmSamples[SENSOR_NUM_OF_SENSORS];
+static sint16 g_slopeOrigins[SENSOR_NUM_OF_SENSORS];
+static uint32 g_slopeTicks[SENSOR_NUM_OF_SENSORS];
+#endif
+
+#if (ADC_VREF_CALIBRATION == 1)
+static uint32 g_nextCalibrationTick = 0;
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static sint16 Sensor_calibrate (const Sensor_ConfigType * Config_Ptr, sint16 temperature)
+{
+	/* Round the Q4.12 product back to Q8.8 then add the offset */
+	sint32 calibrated = Fixed_mulShift (temperature, Config_Ptr->gain, SENSOR_GAIN_SHIFT);
+
+	return Fixed_saturate16 (calibrated + Config_Ptr->offset);
+}
+
+#if (SENSOR_ADAPTIVE_SAMPLING == 1)
+/*
+ * Filter the new calibrated reading into the temperature of the sensor and return
+ * the sampling period for the next reading. The deviation is the distance of the
+ * reading from the filtered value, the slope is the move of the filtered value
+ * over at least SENSOR_SLOW_PERIOD_MS, compared per second against the threshold.
+ */
+static uint16 Sensor_adapt (uint8 id, sint16 temperature)
+{
+	bool fast = (g_calmSamples[id] < SENSOR_CALM_SAMPLES);
+	sint16 deviation = temperature - g_temperatures[id];
+	uint32 elapsedMs = (SysTick_getTicks () - g_slopeTicks[id]) * SYS_TICK_PERIOD_MS;
+	sint16 move;
+	bool moving;
+
+	if (fast)
+	{
+		g_stats[id].fastSamples++;
+	}
+	if (g_statuses[id] != SENSOR_STATUS_OK)
+	{
+		/* First valid reading, or back from a fault: start from it and sample fast */
+		g_temperatures[id] = temperature;
+		g_slopeOrigins[id] = temperature;
+		g_slopeTicks[id] = SysTick_getTicks ();
+		g_calmSamples[id] = 0;
+		return SENSOR_FAST_PERIOD_MS;
+	}
+
+	g_temperatures[id] += deviation >> (fast ? SENSOR_FAST_FILTER_SHIFT : SENSOR_SLOW_FILTER_SHIFT);
+	moving = (deviation > SENSOR_DEVIATION_THRESHOLD) || (deviation < -SENSOR_DEVIATION_THRESHOLD);
+	if (elapsedMs >= SENSOR_SLOW_PERIOD_MS)
+	{
+		move = g_temperatures[id] - g_slopeOrigins[id];
+		moving |= ((uint32)((move < 0) ? -move : move) * 1000 > (uint32)SENSOR_SLOPE_THRESHOLD * elapsedMs);
+		g_slopeOrigins[id] = g_temperatures[id];
+		g_slopeTicks[id] = SysTick_getTicks ();
+	}
+
+	if (moving)
+	{
+		g_calmSamples[id] = 0;
+	}
+	else if (g_calmSamples[id] < SENSOR_CALM_SAMPLES)
+	{
+		g_calmSamples[id]++;
+	}
+	return (g_calmSamples[id] < SENSOR_CALM_SAMPLES) ? SENSOR_FAST_PERIOD_MS : SENSOR_SLOW_PERIOD_MS;
+}
+#endif
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Calibrate the ADC reference then initialize every sensor of the configuration table in sensor_cfg.c.
+ */
+void Sensor_init (void)
+{
+	uint8 id;
+
+#if (ADC_VREF_CALIBRATION == 1)
+	/* The analog sensors are read against a measured reference from the first sample */
+	ADC_calibrate ();
+	g_nextCalibrationTick = SysTick_getTicks () + SYS_TICK_MS_TO_TICKS (ADC_CALIBRATION_PERIOD_MS);
+#endif
+
+	for (id = 0; id < SENSOR_NUM_OF_SENSORS; id++)
+	{
+		g_temperatures[id] = 0;
+		g_statuses[id] = SENSOR_STATUS_NO_DATA;
+		g_stats[id].samples = 0;
+		g_stats[id].fastSamples = 0;
+		g_stats[id].skips = 0;
+#if (SENSOR_ADAPTIVE_SAMPLING == 1)
+		g_nextSampleTicks[id] = SysTick_getTicks ();
+		g_calmSamples[id] = 0;
+#endif
+		if (g_sensorConfigs[id].interface->init != NULL_PTR)
+		{
+			g_sensorConfigs[id].interface->init (g_sensorConfigs[id].channel);
+		}
+	}
+}
+
+/*
+ * Description :
+ * Sampling path, called every loop iteration for all the sensors:
+ * 1. Re-measure the ADC reference every ADC_CALIBRATION_PERIOD_MS and advance the non-blocking drivers.
+ * 2. Read the raw value and convert it to Q8.8 C, with SENSOR_ADAPTIVE_SAMPLING only
+ *    once the sampling period of the sensor elapsed.
+ * 3. Apply the calibration of the instance with saturation, then the filter of the
+ *    sampling rate, and pick the next sampling period from the temperature dynamics.
+ *    A saturated reading is not taken, its status is SENSOR_STATUS_OVER_RANGE.
+ */
+void Sensor_update (void)
+{
+	const Sensor_ConfigType * config;
+	Sensor_StatusType status;
+	sint16 temperature;
+	sint16 raw;
+	uint8 id;
+
+#if (ADC_VREF_CALIBRATION == 1)
+	/* The reference drifts slowly with the temperature, a few conversions every period follow it */
+	if ((sint32)(SysTick_getTicks () - g_nextCalibrationTick) >= 0)
+	{
+		g_nextCalibrationTick += SYS_TICK_MS_TO_TICKS (ADC_CALIBRATION_PERIOD_MS);
+		ADC_calibrate ();
+	}
+#endif
+
+	for (id = 0; id < SENSOR_NUM_OF_SENSORS; id++)
+	{
+		config = &g_sensorConfigs[id];
+		if (config->interface->step != NULL_PTR)
+		{
+			config->interface->step ();
+		}
+
+#if (SENSOR_ADAPTIVE_SAMPLING == 1)
+		if ((sint32)(SysTick_getTicks () - g_nextSampleTicks[id]) < 0)
+		{
+			g_stats[id].skips++;
+			continue;
+		}
+#endif
+		raw = config->interface->read (config->channel);
+		status = config->interface->status (config->channel);
+		g_stats[id].samples++;
+		if (status == SENSOR_STATUS_OK)
+		{
+			temperature = Sensor_calibrate (config, config->interface->convert (raw));
+			if ((temperature == SENSOR_TEMPERATURE_MAX) || (temperature == SENSOR_TEMPERATURE_MIN))
+			{
+				status = SENSOR_STATUS_OVER_RANGE;     /* The true value is unknown, it is not filtered in */
+			}
+		}
+		if (status == SENSOR_STATUS_OK)
+		{
+#if (SENSOR_ADAPTIVE_SAMPLING == 1)
+			g_nextSampleTicks[id] = SysTick_getTicks () + SYS_TICK_MS_TO_TICKS (Sensor_adapt (id, temperature));
+#else
+			g_temperatures[id] = temperature;
+#endif
+		}
+#if (SENSOR_ADAPTIVE_SAMPLING == 1)
+		else
+		{
+			/* A faulty sensor is retried at the fast period */
+			g_nextSampleTicks[id] = SysTick_getTicks () + SYS_TICK_MS_TO_TICKS (SENSOR_FAST_PERIOD_MS);
+		}
+#endif
+		g_statuses[id] = status;
+	}
+}
+
+/*
+ * Description :
+ * Copy the last calibrated temperature of the sensor in Q8.8 C.
+ * Returns the status of its last reading.
+ */
+Sensor_StatusType Sensor_getTemperature (uint8 id, sint16 * Temperature_Ptr)
+{
+	if (id >= SENSOR_NUM_OF_SENSORS)
+	{
+		return SENSOR_STATUS_FAULT;
+	}
+	*Temperature_Ptr = g_temperatures[id];
+	return g_statuses[id];
+}
+
+/*
+ * Description :
+ * Return the whole degrees of the sensor for the control loop, truncated as the
+ * LM35 driver always did and clamped to 0 .. 127, or SENSOR_FAULT_TEMPERATURE if
+ * the sensor has no valid reading.
+ */
+uint8 Sensor_getCelsius (uint8 id)
+{
+	sint16 temperature;
+	sint16 celsius;
+
+	if (Sensor_getTemperature (id, &temperature) != SENSOR_STATUS_OK)
+	{
+		return SENSOR_FAULT_TEMPERATURE;
+	}
+	celsius = temperature >> SENSOR_TEMPERATURE_SHIFT;         /* Rounding would move the fan curve thresholds by 0.5 C */
+	return (celsius < 0) ? 0 : (uint8)celsius;
+}
+
+/*
+ * Description :
+ * Copy the sampling counters of the sensor.
+ */
+void Sensor_getStats (uint8 id, Sensor_StatsType * Stats_Ptr)
+{
+	if (id < SENSOR_NUM_OF_SENSORS)
+	{
+		*Stats_Ptr = g_stats[id];
+	}
+}
@@ -0,0 +1,139 @@
+/******************************************************************************
+ *
+ * Module: SENSOR
+ *
+ * File Name: sensor.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the temperature sensor abstraction. Every sensor
+ *              type implements the same interface table and every configured
+ *              sensor instance gets its own fixed-point calibration.
+ *
+ *******************************************************************************/
+
+#ifndef SENSOR_H_
+#define SENSOR_H_
+
+#include "std_types.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Parameters Definitions, the temperatures are Q8.8 C (-128 .. +127.99 C) */
+#define SENSOR_TEMPERATURE_SHIFT                 FIXED_Q8_8_SHIFT
+#define SENSOR_TEMPERATURE_MAX                   FIXED_Q8_8_MAX
+#define SENSOR_TEMPERATURE_MIN                   FIXED_Q8_8_MIN
+#define SENSOR_OFFSET(VALUE)                     FIXED_Q8_8(VALUE)
+
+/* The calibration gain is Q4.12, SENSOR_GAIN(1.0) leaves the reading unchanged */
+#define SENSOR_GAIN_SHIFT                        12
+#define SENSOR_GAIN(VALUE)                       ((uint16)((VALUE) * 4096.0 + 0.5))
+
+/*
+ * Static Configurations of the adaptive sampling, 1 = every sensor is read at the slow
+ * period with deep filtering while its temperature is steady, and at the fast period
+ * with light filtering once a reading leaves the filtered value by the deviation or
+ * the filtered value moves faster than the slope. SENSOR_CALM_SAMPLES fast samples
+ * without either go back to the slow period. 0 = read every sensor every loop.
+ */
+#define SENSOR_ADAPTIVE_SAMPLING                 1
+#define SENSOR_SLOW_PERIOD_MS                    500
+#define SENSOR_FAST_PERIOD_MS                    20
+#define SENSOR_SLOW_FILTER_SHIFT                 3          /* Exponential filter weight of 1/8 */
+#define SENSOR_FAST_FILTER_SHIFT                 1          /* Exponential filter weight of 1/2 */
+#define SENSOR_DEVIATION_THRESHOLD               SENSOR_OFFSET(1.5)
+#define SENSOR_SLOPE_THRESHOLD                   SENSOR_OFFSET(0.5)     /* C per second */
+#define SENSOR_CALM_SAMPLES                      25
+
+/* Whole degrees given to the control loop when the sensor has no valid reading, runs the fan at full speed */
+#define SENSOR_FAULT_TEMPERATURE                 0xFF
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+/* OVER_RANGE: the calibrated reading saturated the Q8.8 range, e.g. an LM35 above 127.99 C */
+typedef enum
+{
+	SENSOR_STATUS_NO_DATA, SENSOR_STATUS_OK, SENSOR_STATUS_FAULT, SENSOR_STATUS_OVER_RANGE
+} Sensor_StatusType;
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/*
+ * Interface implemented by every sensor type (a const table in its driver).
+ * The channel is the ADC channel of an analog sensor, digital sensors ignore it.
+ */
+typedef struct{
+	void (*init)(uint8 channel);
+	void (*step)(void);                                  /* Advance a non-blocking driver, NULL_PTR if none */
+	sint16 (*read)(uint8 channel);                       /* Latest raw reading in the sensor units */
+	sint16 (*convert)(sint16 raw);                       /* Raw reading to Q8.8 C */
+	Sensor_StatusType (*status)(uint8 channel);          /* Validity of the latest raw reading */
+} Sensor_InterfaceType;
+
+/* Sampling counters of a sensor, the skips are the loop iterations which did not read it */
+typedef struct{
+	uint32 samples;
+	uint32 fastSamples;
+	uint32 skips;
+} Sensor_StatsType;
+
+/* One sensor instance: calibrated = converted * gain + offset */
+typedef struct{
+	const Sensor_InterfaceType * interface;
+	uint8 channel;
+	uint16 gain;                       /* Q4.12 */
+	sint16 offset;                     /* Q8.8 C */
+} Sensor_ConfigType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Calibrate the ADC reference then initialize every sensor of the configuration table in sensor_cfg.c.
+ */
+void Sensor_init (void);
+
+/*
+ * Description :
+ * Sampling path, called every loop iteration for all the sensors:
+ * 1. Re-measure the ADC reference every ADC_CALIBRATION_PERIOD_MS and advance the non-blocking drivers.
+ * 2. Read the raw value and convert it to Q8.8 C, with SENSOR_ADAPTIVE_SAMPLING only
+ *    once the sampling period of the sensor elapsed.
+ * 3. Apply the calibration of the instance with saturation, then the filter of the
+ *    sampling rate, and pick the next sampling period from the temperature dynamics.
+ *    A saturated reading is not taken, its status is SENSOR_STATUS_OVER_RANGE.
+ */
+void Sensor_update (void);
+
+/*
+ * Description :
+ * Copy the last calibrated temperature of the sensor in Q8.8 C.
+ * Returns the status of its last reading.
+ */
+Sensor_StatusType Sensor_getTemperature (uint8 id, sint16 * Temperature_Ptr);
+
+/*
+ * Description :
+ * Return the whole degrees of the sensor for the control loop, truncated as the
+ * LM35 driver always did and clamped to 0 .. 127, or SENSOR_FAULT_TEMPERATURE if
+ * the sensor has no valid reading.
+ */
+uint8 Sensor_getCelsius (uint8 id);
+
+/*
+ * Description :
+ * Copy the sampling counters of the sensor.
+ */
+void Sensor_getStats (uint8 id, Sensor_StatsType * Stats_Ptr);
+
+#endif /* SENSOR_H_ */
@@ -0,0 +1,38 @@
+/******************************************************************************
+ *
+ * Module: SENSOR
+ *
+ * File Name: sensor_cfg.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Static configuration of the temperature sensor instances
+ *
+ *******************************************************************************/
+
+#include "sensor_cfg.h"
+#include "lm_35.h"
+#include "ds18b20.h"
+#include "lm75.h"
+#include "lcd.h"
+
+#if ((SENSOR_LM75_ENABLE == 1) && (LCD_PIN_REMAP == 0))
+#error "The TWI pins PC0/PC1 are taken by the LCD, set LCD_PIN_REMAP to 1"
+#endif
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* A new sensor is one more line here, in the order of its id in sensor_cfg.h */
+const Sensor_ConfigType g_sensorConfigs[SENSOR_NUM_OF_SENSORS] = {
+	{&LM_35_sensorInterface, LM_35_SENSOR_CHANNEL, SENSOR_GAIN(1.0), SENSOR_OFFSET(0.0)},
+#if (SENSOR_DS18B20_ENABLE == 1)
+	{&DS18B20_sensorInterface, 0, SENSOR_GAIN(1.0), SENSOR_OFFSET(0.0)},
+#endif
+#if (SENSOR_LM75_ENABLE == 1)
+	{&LM75_sensorInterface, 0, SENSOR_GAIN(1.0), SENSOR_OFFSET(0.0)},
+#endif
+};
@@ -0,0 +1,52 @@
+/******************************************************************************
+ *
+ * Module: SENSOR
+ *
+ * File Name: sensor_cfg.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Static configuration of the temperature sensor instances
+ *
+ *******************************************************************************/
+
+#ifndef SENSOR_CFG_H_
+#define SENSOR_CFG_H_
+
+#include "sensor.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*
+ * Static Configurations of the digital sensors, 1 = add the sensor to g_sensorConfigs after
+ * the LM35. The DS18B20 is on PD7, the LM75 on the TWI pins which need LCD_PIN_REMAP 1.
+ */
+#define SENSOR_DS18B20_ENABLE                    0
+#define SENSOR_LM75_ENABLE                       0
+
+#if ((SENSOR_DS18B20_ENABLE != 0) && (SENSOR_DS18B20_ENABLE != 1))
+#error "SENSOR_DS18B20_ENABLE must be 0 or 1"
+#endif
+#if ((SENSOR_LM75_ENABLE != 0) && (SENSOR_LM75_ENABLE != 1))
+#error "SENSOR_LM75_ENABLE must be 0 or 1"
+#endif
+
+/* The ids are the indexes in g_sensorConfigs of sensor_cfg.c, the id of a disabled sensor is not valid */
+#define SENSOR_LM_35_ID                          0
+#define SENSOR_DS18B20_ID                        (SENSOR_LM_35_ID + SENSOR_DS18B20_ENABLE)
+#define SENSOR_LM75_ID                           (SENSOR_DS18B20_ID + SENSOR_LM75_ENABLE)
+#define SENSOR_NUM_OF_SENSORS                    (SENSOR_LM75_ID + 1)
+
+/* The sensor followed by the fan control loop */
+#define SENSOR_CONTROL_ID                        SENSOR_LM_35_ID
+
+/*******************************************************************************
+ *                           External Variables                                *
+ *******************************************************************************/
+extern const Sensor_ConfigType g_sensorConfigs[SENSOR_NUM_OF_SENSORS];
+
+#endif /* SENSOR_CFG_H_ */
@@ -0,0 +1,102 @@
+/******************************************************************************
+ *
+ * Module: SLOPE
+ *
+ * File Name: slope_estimator.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the integer least-squares slope of the last samples
+ *
+ *******************************************************************************/
+
+#include "slope_estimator.h"
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Forget all the samples of the estimator.
+ */
+void Slope_init (Slope_EstimatorType * Slope_Ptr)
+{
+	Slope_Ptr -> oldest = 0;
+	Slope_Ptr -> count = 0;
+	Slope_Ptr -> sum = 0;
+	Slope_Ptr -> weightedSum = 0;
+}
+
+/*
+ * Description :
+ * Add the newest sample to the window, dropping the oldest one once it is full.
+ * The samples must be taken at a fixed period, any sint16 value fits the 32-bit sums.
+ */
+void Slope_addSample (Slope_EstimatorType * Slope_Ptr, sint16 sample)
+{
+	uint8 position;
+	sint16 dropped;
+
+	if (Slope_Ptr -> count < SLOPE_WINDOW_LENGTH)
+	{
+		position = Slope_Ptr -> oldest + Slope_Ptr -> count;
+		if (position >= SLOPE_WINDOW_LENGTH)
+		{
+			position -= SLOPE_WINDOW_LENGTH;
+		}
+		Slope_Ptr -> samples[position] = sample;
+		Slope_Ptr -> weightedSum += (sint32)Slope_Ptr -> count * sample;
+		Slope_Ptr -> sum += sample;
+		Slope_Ptr -> count++;
+		return;
+	}
+
+	/*
+	 * Every kept sample moves one index down, which removes the sum of the kept
+	 * samples from the weighted sum, and the new one enters at the last index
+	 */
+	dropped = Slope_Ptr -> samples[Slope_Ptr -> oldest];
+	Slope_Ptr -> weightedSum -= Slope_Ptr -> sum - dropped;
+	Slope_Ptr -> weightedSum += (sint32)(SLOPE_WINDOW_LENGTH - 1) * sample;
+	Slope_Ptr -> sum += (sint32)sample - dropped;
+	Slope_Ptr -> samples[Slope_Ptr -> oldest] = sample;
+	Slope_Ptr -> oldest++;
+	if (Slope_Ptr -> oldest >= SLOPE_WINDOW_LENGTH)
+	{
+		Slope_Ptr -> oldest = 0;
+	}
+}
+
+/*
+ * Description :
+ * Return the slope of the least-squares line through the window, in sample units
+ * per sample period with SLOPE_FRACTION_BITS fraction bits (Q8.8 for Celsius samples).
+ * Returns zero until the window holds two samples.
+ */
+sint32 Slope_get (const Slope_EstimatorType * Slope_Ptr)
+{
+	sint32 n = Slope_Ptr -> count;
+	sint32 numerator;
+	sint32 denominator;
+	sint32 quotient;
+
+	if (n < 2)
+	{
+		return 0;
+	}
+
+	/*
+	 * slope = (n * sum(i * y) - sum(i) * sum(y)) / (n * sum(i^2) - sum(i)^2)
+	 * with sum(i) = n(n-1)/2 and the denominator equal to n^2 (n^2 - 1) / 12
+	 */
+	numerator = n * Slope_Ptr -> weightedSum - (n * (n - 1) / 2) * Slope_Ptr -> sum;
+	denominator = n * n * (n * n - 1) / 12;
+
+	/* Divide in two steps so the fraction bits never overflow the numerator */
+	quotient = numerator / denominator;
+	return quotient * (1L << SLOPE_FRACTION_BITS)
+			+ (numerator - quotient * denominator) * (1L << SLOPE_FRACTION_BITS) / denominator;
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+ *
+ * Module: SLOPE
+ *
+ * File Name: slope_estimator.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the integer least-squares slope of the last samples
+ *
+ *******************************************************************************/
+
+#ifndef SLOPE_ESTIMATOR_H_
+#define SLOPE_ESTIMATOR_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define SLOPE_WINDOW_LENGTH                      16         /* Samples fitted by the line, 2 .. 32 */
+
+/* Parameters Definitions */
+#define SLOPE_FRACTION_BITS                      8
+
+#if ((SLOPE_WINDOW_LENGTH < 2) || (SLOPE_WINDOW_LENGTH > 32))
+#error "The slope window must hold 2 to 32 samples to keep the sums in 32 bits"
+#endif
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/*
+ * Sliding window of equally spaced samples, index 0 is the oldest one.
+ * The sums are updated on every sample so the fit never walks the window:
+ *   sum         = sum(y[i])
+ *   weightedSum = sum(i * y[i])
+ */
+typedef struct{
+	sint16 samples[SLOPE_WINDOW_LENGTH];
+	uint8 oldest;                      /* Position of index 0 in samples[] */
+	uint8 count;
+	sint32 sum;
+	sint32 weightedSum;
+} Slope_EstimatorType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Forget all the samples of the estimator.
+ */
+void Slope_init (Slope_EstimatorType * Slope_Ptr);
+
+/*
+ * Description :
+ * Add the newest sample to the window, dropping the oldest one once it is full.
+ * The samples must be taken at a fixed period, any sint16 value fits the 32-bit sums.
+ */
+void Slope_addSample (Slope_EstimatorType * Slope_Ptr, sint16 sample);
+
+/*
+ * Description :
+ * Return the slope of the least-squares line through the window, in sample units
+ * per sample period with SLOPE_FRACTION_BITS fraction bits (Q8.8 for Celsius samples).
+ * Returns zero until the window holds two samples.
+ */
+sint32 Slope_get (const Slope_EstimatorType * Slope_Ptr);
+
+#endif /* SLOPE_ESTIMATOR_H_ */
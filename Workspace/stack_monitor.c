@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ * Module: STACK_MONITOR
+ *
+ * File Name: stack_monitor.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the stack painting and high-watermark module
+ *
+ *******************************************************************************/
+
+#include "stack_monitor.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Symbols provided by the linker script */
+extern uint8 _end;                 /* First free byte after .data, .bss and .noinit */
+extern uint8 __stack;              /* Initial stack pointer (RAMEND) */
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Fill the whole region between the static data and the top of the stack with
+ * the paint pattern. It runs from .init1 before the stack pointer and the zero
+ * register are set up, so it is naked and written in assembly to use no stack.
+ */
+void StackMonitor_paint (void) __attribute__ ((naked, used, section (".init1")));
+void StackMonitor_paint (void)
+{
+	__asm volatile (
+			"    ldi r30, lo8(_end)      \n"
+			"    ldi r31, hi8(_end)      \n"
+			"    ldi r24, %0             \n"
+			"    ldi r25, hi8(__stack)   \n"
+			"    rjmp 2f                 \n"
+			"1:  st Z+, r24              \n"
+			"2:  cpi r30, lo8(__stack)   \n"
+			"    cpc r31, r25            \n"
+			"    brlo 1b                 \n"
+			"    breq 1b                 \n"
+			:: "M" (STACK_MONITOR_PAINT_PATTERN));
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return the size of the free SRAM between the end of the static data
+ * (.data, .bss and .noinit) and the top of the stack at reset.
+ */
+uint16 StackMonitor_getRegionSize (void)
+{
+	return (uint16)(&__stack - &_end) + 1;
+}
+
+/*
+ * Description :
+ * Return the number of bytes of the stack region which were never written
+ * since reset, by counting the paint pattern up from the end of the static data.
+ */
+uint16 StackMonitor_getUnusedBytes (void)
+{
+	const uint8 * ptr = &_end;
+	uint16 count = 0;
+
+	/* The stack grows down so the untouched bytes are the lowest ones of the region */
+	while ((ptr <= &__stack) && (*ptr == STACK_MONITOR_PAINT_PATTERN))
+	{
+		ptr++;
+		count++;
+	}
+	return count;
+}
+
+/*
+ * Description :
+ * Return the deepest stack usage in bytes reached since reset (the high watermark).
+ */
+uint16 StackMonitor_getHighWatermark (void)
+{
+	return StackMonitor_getRegionSize () - StackMonitor_getUnusedBytes ();
+}
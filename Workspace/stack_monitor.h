@@ -0,0 +1,51 @@
+/******************************************************************************
+ *
+ * Module: STACK_MONITOR
+ *
+ * File Name: stack_monitor.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the stack painting and high-watermark module
+ *
+ *******************************************************************************/
+
+#ifndef STACK_MONITOR_H_
+#define STACK_MONITOR_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Parameters Definitions */
+#define STACK_MONITOR_PAINT_PATTERN              0xC5
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return the size of the free SRAM between the end of the static data
+ * (.data, .bss and .noinit) and the top of the stack at reset.
+ */
+uint16 StackMonitor_getRegionSize (void);
+
+/*
+ * Description :
+ * Return the number of bytes of the stack region which were never written
+ * since reset, by counting the paint pattern up from the end of the static data.
+ */
+uint16 StackMonitor_getUnusedBytes (void);
+
+/*
+ * Description :
+ * Return the deepest stack usage in bytes reached since reset (the high watermark).
+ */
+uint16 StackMonitor_getHighWatermark (void);
+
+#endif /* STACK_MONITOR_H_ */
@@ -33,11 +33,22 @@ typedef unsigned char         uint8;          /*           0 .. 255
 typedef signed char           sint8;          /*        -128 .. +127             */
 typedef unsigned short        uint16;         /*           0 .. 65535            */
 typedef signed short          sint16;         /*      -32768 .. +32767           */
+#if defined(__AVR__)
 typedef unsigned long         uint32;         /*           0 .. 4294967295       */
 typedef signed long           sint32;         /* -2147483648 .. +2147483647      */
+#else
+/* Host builds (Host/, Benchmark/): long is 64-bit on LP64, keep the wrap-around of the target */
+#include <stdint.h>
+typedef uint32_t              uint32;         /*           0 .. 4294967295       */
+typedef int32_t               sint32;         /* -2147483648 .. +2147483647      */
+#endif
 typedef unsigned long long    uint64;         /*       0 .. 18446744073709551615  */
 typedef signed long long      sint64;         /* -9223372036854775808 .. 9223372036854775807 */
 typedef float                 float32;
 typedef double                float64;
 
+/* The tick deadlines (sint32)(a - b) and the Q16.16 math rely on 32-bit wrap-around */
+_Static_assert (sizeof(uint32) == 4, "uint32 must be 32-bit");
+_Static_assert (sizeof(sint32) == 4, "sint32 must be 32-bit");
+
 #endif /* STD_TYPE_H_ */
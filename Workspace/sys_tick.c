@@ -0,0 +1,85 @@
+/******************************************************************************
+ *
+ * Module: SYS_TICK
+ *
+ * File Name: sys_tick.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the periodic system tick on Timer2
+ *
+ *******************************************************************************/
+
+#include <util/atomic.h>
+#include "sys_tick.h"
+#include "timer.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static volatile uint32 g_ticks = 0;
+static void (*volatile g_callBackPtr)(void) = NULL_PTR;
+
+static const Timer_ConfigType g_timerConfig = {
+	TIMER_CTC_MODE, TIMER_PRESCALER_OF (SYS_TICK_TIMER_DIVISION), 0,
+	{SYS_TICK_COMPARE_VALUE, 0}, {TIMER_OUTPUT_DISCONNECTED, TIMER_OUTPUT_DISCONNECTED},
+	TIMER_INTERRUPT (TIMER_EVENT_COMPARE_A), TIMER_CAPTURE_FALLING
+};
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* Called from the Timer2 compare interrupt */
+static void SysTick_isr (void)
+{
+	g_ticks++;
+	if (g_callBackPtr != NULL_PTR)
+	{
+		(*g_callBackPtr)();
+	}
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Start Timer2 in CTC mode with a compare interrupt every SYS_TICK_PERIOD_MS.
+ */
+void SysTick_init (void)
+{
+	g_ticks = 0;
+	Timer_setCallBack (TIMER2_ID, TIMER_EVENT_COMPARE_A, SysTick_isr);
+	Timer_init (TIMER2_ID, &g_timerConfig);
+}
+
+/*
+ * Description :
+ * Save the address of the function called from the tick interrupt, it must be short
+ * as it runs with the interrupts disabled.
+ */
+void SysTick_setCallBack (void (*a_ptr)(void))
+{
+	g_callBackPtr = a_ptr;
+}
+
+/*
+ * Description :
+ * Return the number of ticks since the initialization.
+ */
+uint32 SysTick_getTicks (void)
+{
+	uint32 ticks;
+
+	/* The 32-bit counter is read in four bytes, the tick interrupt must not split them.
+	 * The interrupt state is restored, so a call before sei() at boot keeps them disabled */
+	ATOMIC_BLOCK (ATOMIC_RESTORESTATE)
+	{
+		ticks = g_ticks;
+	}
+	return ticks;
+}
@@ -0,0 +1,64 @@
+/******************************************************************************
+ *
+ * Module: SYS_TICK
+ *
+ * File Name: sys_tick.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the periodic system tick on Timer2
+ *
+ *******************************************************************************/
+
+#ifndef SYS_TICK_H_
+#define SYS_TICK_H_
+
+#include "std_types.h"
+#include "timer.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define SYS_TICK_PERIOD_MS                       10
+
+/* Parameters Definitions */
+#define SYS_TICK_FREQUENCY_HZ                    (1000UL / SYS_TICK_PERIOD_MS)
+#define SYS_TICK_TIMER_DIVISION                  TIMER2_DIVISION (SYS_TICK_FREQUENCY_HZ, TIMER_8_BIT_MAX_TOP)
+#define SYS_TICK_COMPARE_VALUE                   TIMER_TOP (SYS_TICK_FREQUENCY_HZ, SYS_TICK_TIMER_DIVISION)
+#define SYS_TICK_MS_TO_TICKS(MS)                 ((uint32)(MS) / SYS_TICK_PERIOD_MS)
+
+#if ((1000UL % SYS_TICK_PERIOD_MS) != 0)
+#error "The system tick period must divide one second"
+#endif
+#if (!TIMER_FITS (SYS_TICK_FREQUENCY_HZ, SYS_TICK_TIMER_DIVISION, TIMER_8_BIT_MAX_TOP))
+#error "The system tick period does not fit in the 8-bit Timer2"
+#endif
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Start Timer2 in CTC mode with a compare interrupt every SYS_TICK_PERIOD_MS.
+ */
+void SysTick_init (void);
+
+/*
+ * Description :
+ * Save the address of the function called from the tick interrupt, it must be short
+ * as it runs with the interrupts disabled.
+ */
+void SysTick_setCallBack (void (*a_ptr)(void));
+
+/*
+ * Description :
+ * Return the number of ticks since the initialization.
+ */
+uint32 SysTick_getTicks (void);
+
+#endif /* SYS_TICK_H_ */
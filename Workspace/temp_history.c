@@ -0,0 +1,315 @@
+/******************************************************************************
+ *
+ * Module: TEMP_HISTORY
+ *
+ * File Name: temp_history.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the in-RAM temperature history: a ring buffer of
+ *              timestamped samples and a decimated long-term tier per channel,
+ *              with sliding window statistics updated in O(1) per sample.
+ *
+ *******************************************************************************/
+
+#include "temp_history.h"
+#include "sys_tick.h"
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/*
+ * Book-keeping of one sliding window. The sums give the mean and the variance,
+ * the min and max come from monotonic queues of slot indexes (ascending values
+ * for the min and descending for the max) so the front is always the extreme.
+ */
+typedef struct{
+	uint8 head;                        /* Next slot to write, the oldest one once the window is full */
+	uint8 count;
+	uint16 sum;
+	uint32 sumSq;
+	uint8 minFirst;
+	uint8 minCount;
+	uint8 maxFirst;
+	uint8 maxCount;
+} TempHistory_WindowType;
+
+typedef struct{
+	uint32 nextSampleTick;
+	uint8 newSamples;                  /* Raw samples not summarized in the long-term tier yet */
+
+	TempHistory_WindowType raw;
+	TempHistory_WindowType longTerm;
+} TempHistory_ChannelType;
+
+/* Arrays of one tier of a channel, raw samples use the same array for min, mean and max */
+typedef struct{
+	TempHistory_WindowType * window;
+	uint8 capacity;
+	uint16 * times;
+	uint8 * mins;
+	uint8 * means;
+	uint8 * maxs;
+	uint8 * minQueue;
+	uint8 * maxQueue;
+} TempHistory_TierViewType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static TempHistory_ChannelType g_channels[TEMP_HISTORY_NUM_OF_CHANNELS];
+
+/* The records are kept outside the packed channel structure so the tiers can be accessed through pointers */
+static uint16 g_rawTimes[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_RAW_LENGTH];
+static uint8 g_rawTemps[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_RAW_LENGTH];
+static uint8 g_rawMinQueues[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_RAW_LENGTH];
+static uint8 g_rawMaxQueues[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_RAW_LENGTH];
+
+static uint16 g_longTimes[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_LONG_LENGTH];
+static uint8 g_longMins[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_LONG_LENGTH];
+static uint8 g_longMeans[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_LONG_LENGTH];
+static uint8 g_longMaxs[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_LONG_LENGTH];
+static uint8 g_longMinQueues[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_LONG_LENGTH];
+static uint8 g_longMaxQueues[TEMP_HISTORY_NUM_OF_CHANNELS][TEMP_HISTORY_LONG_LENGTH];
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static uint8 TempHistory_wrap (uint8 index, uint8 capacity)
+{
+	return (index >= capacity) ? (uint8)(index - capacity) : index;
+}
+
+static void TempHistory_getView (uint8 channel, TempHistory_TierType tier, TempHistory_TierViewType * view)
+{
+	if (tier == TEMP_HISTORY_RAW)
+	{
+		view->window = &g_channels[channel].raw;
+		view->capacity = TEMP_HISTORY_RAW_LENGTH;
+		view->times = g_rawTimes[channel];
+		view->mins = g_rawTemps[channel];
+		view->means = g_rawTemps[channel];
+		view->maxs = g_rawTemps[channel];
+		view->minQueue = g_rawMinQueues[channel];
+		view->maxQueue = g_rawMaxQueues[channel];
+	}
+	else
+	{
+		view->window = &g_channels[channel].longTerm;
+		view->capacity = TEMP_HISTORY_LONG_LENGTH;
+		view->times = g_longTimes[channel];
+		view->mins = g_longMins[channel];
+		view->means = g_longMeans[channel];
+		view->maxs = g_longMaxs[channel];
+		view->minQueue = g_longMinQueues[channel];
+		view->maxQueue = g_longMaxQueues[channel];
+	}
+}
+
+/*
+ * Description :
+ * Add a record to the window, overwriting the oldest one when it is full.
+ * Every slot enters and leaves each queue once, so the cost is O(1) amortized.
+ */
+static void TempHistory_push (const TempHistory_TierViewType * view, uint16 time, uint8 min, uint8 mean, uint8 max)
+{
+	TempHistory_WindowType * window = view->window;
+	uint8 slot = window->head;
+
+	if (window->count == view->capacity)
+	{
+		/* The oldest record leaves the window, it can only be at the front of a queue */
+		window->sum -= view->means[slot];
+		window->sumSq -= (uint16)view->means[slot] * view->means[slot];
+		if ((window->minCount != 0) && (view->minQueue[window->minFirst] == slot))
+		{
+			window->minFirst = TempHistory_wrap (window->minFirst + 1, view->capacity);
+			window->minCount--;
+		}
+		if ((window->maxCount != 0) && (view->maxQueue[window->maxFirst] == slot))
+		{
+			window->maxFirst = TempHistory_wrap (window->maxFirst + 1, view->capacity);
+			window->maxCount--;
+		}
+	}
+	else
+	{
+		window->count++;
+	}
+
+	view->times[slot] = time;
+	view->mins[slot] = min;
+	view->means[slot] = mean;
+	view->maxs[slot] = max;
+	window->sum += mean;
+	window->sumSq += (uint16)mean * mean;
+
+	/* Drop the records which can never be the extreme again as the new one is newer and as extreme */
+	while ((window->minCount != 0) &&
+			(view->mins[view->minQueue[TempHistory_wrap (window->minFirst + window->minCount - 1, view->capacity)]] >= min))
+	{
+		window->minCount--;
+	}
+	view->minQueue[TempHistory_wrap (window->minFirst + window->minCount, view->capacity)] = slot;
+	window->minCount++;
+
+	while ((window->maxCount != 0) &&
+			(view->maxs[view->maxQueue[TempHistory_wrap (window->maxFirst + window->maxCount - 1, view->capacity)]] <= max))
+	{
+		window->maxCount--;
+	}
+	view->maxQueue[TempHistory_wrap (window->maxFirst + window->maxCount, view->capacity)] = slot;
+	window->maxCount++;
+
+	window->head = TempHistory_wrap (slot + 1, view->capacity);
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Empty both tiers of all the channels.
+ */
+void TempHistory_init (void)
+{
+	uint8 channel;
+
+	for (channel = 0; channel < TEMP_HISTORY_NUM_OF_CHANNELS; channel++)
+	{
+		TempHistory_clear (channel);
+		g_channels[channel].nextSampleTick = 0;
+	}
+}
+
+/*
+ * Description :
+ * Empty both tiers of the given channel.
+ */
+void TempHistory_clear (uint8 channel)
+{
+	static const TempHistory_WindowType emptyWindow = {0, 0, 0, 0, 0, 0, 0, 0};
+
+	if (channel >= TEMP_HISTORY_NUM_OF_CHANNELS)
+	{
+		return;
+	}
+	g_channels[channel].raw = emptyWindow;
+	g_channels[channel].longTerm = emptyWindow;
+	g_channels[channel].newSamples = 0;
+}
+
+/*
+ * Description :
+ * Called every loop iteration with the latest temperature of the channel, a sample
+ * is only stored every TEMP_HISTORY_SAMPLE_PERIOD_S of the system tick.
+ */
+void TempHistory_update (uint8 channel, uint8 temperature)
+{
+	uint32 now = SysTick_getTicks ();
+
+	if ((channel >= TEMP_HISTORY_NUM_OF_CHANNELS) || ((sint32)(now - g_channels[channel].nextSampleTick) < 0))
+	{
+		return;
+	}
+	g_channels[channel].nextSampleTick = now + SYS_TICK_MS_TO_TICKS (TEMP_HISTORY_SAMPLE_PERIOD_S * 1000UL);
+	TempHistory_addSample (channel, (uint16)(now / SYS_TICK_MS_TO_TICKS (1000)), temperature);
+}
+
+/*
+ * Description :
+ * Store one sample taken at the given time in the raw tier, each full raw window
+ * adds its min/mean/max summary to the long-term tier.
+ */
+void TempHistory_addSample (uint8 channel, uint16 time, uint8 temperature)
+{
+	TempHistory_TierViewType view;
+	TempHistory_StatsType stats;
+
+	if (channel >= TEMP_HISTORY_NUM_OF_CHANNELS)
+	{
+		return;
+	}
+	TempHistory_getView (channel, TEMP_HISTORY_RAW, &view);
+	TempHistory_push (&view, time, temperature, temperature, temperature);
+
+	/* Decimation: one long-term record per window of new raw samples */
+	g_channels[channel].newSamples++;
+	if (g_channels[channel].newSamples == TEMP_HISTORY_RAW_LENGTH)
+	{
+		g_channels[channel].newSamples = 0;
+		TempHistory_getStats (channel, TEMP_HISTORY_RAW, &stats);
+		TempHistory_getView (channel, TEMP_HISTORY_LONG, &view);
+		TempHistory_push (&view, time, stats.min,
+				(uint8)((stats.mean + (1 << (TEMP_HISTORY_MEAN_SHIFT - 1))) >> TEMP_HISTORY_MEAN_SHIFT), stats.max);
+	}
+}
+
+/*
+ * Description :
+ * Copy the statistics of the whole window of the given tier.
+ * Returns FALSE if the channel is wrong or the window is still empty.
+ */
+bool TempHistory_getStats (uint8 channel, TempHistory_TierType tier, TempHistory_StatsType * Stats_Ptr)
+{
+	TempHistory_TierViewType view;
+	const TempHistory_WindowType * window;
+	uint32 spread;
+
+	if (channel >= TEMP_HISTORY_NUM_OF_CHANNELS)
+	{
+		return FALSE;
+	}
+	TempHistory_getView (channel, tier, &view);
+	window = view.window;
+	if (window->count == 0)
+	{
+		return FALSE;
+	}
+
+	Stats_Ptr->count = window->count;
+	Stats_Ptr->min = view.mins[view.minQueue[window->minFirst]];
+	Stats_Ptr->max = view.maxs[view.maxQueue[window->maxFirst]];
+	Stats_Ptr->mean = (uint16)(((uint32)window->sum << TEMP_HISTORY_MEAN_SHIFT) / window->count);
+
+	/* n.sum(x^2) - sum(x)^2 is n^2 times the variance, divided in two steps to stay in 32 bits */
+	spread = (window->count * window->sumSq) - ((uint32)window->sum * window->sum);
+	Stats_Ptr->variance = ((spread / window->count) << TEMP_HISTORY_MEAN_SHIFT) / window->count;
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Bulk dump: copy up to maxRecords records of the tier, oldest first, starting
+ * from the given position in the window.
+ * Returns the number of copied records.
+ */
+uint8 TempHistory_dump (uint8 channel, TempHistory_TierType tier, uint8 first,
+		TempHistory_RecordType * Records_Ptr, uint8 maxRecords)
+{
+	TempHistory_TierViewType view;
+	uint8 oldest;
+	uint8 slot;
+	uint8 i;
+
+	if (channel >= TEMP_HISTORY_NUM_OF_CHANNELS)
+	{
+		return 0;
+	}
+	TempHistory_getView (channel, tier, &view);
+	oldest = (view.window->count == view.capacity) ? view.window->head : 0;
+
+	for (i = 0; (i < maxRecords) && (first + i < view.window->count); i++)
+	{
+		slot = TempHistory_wrap (oldest + ((first + i) % view.capacity), view.capacity);
+		Records_Ptr[i].time = view.times[slot];
+		Records_Ptr[i].min = view.mins[slot];
+		Records_Ptr[i].mean = view.means[slot];
+		Records_Ptr[i].max = view.maxs[slot];
+	}
+	return i;
+}
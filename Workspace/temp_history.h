@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Module: TEMP_HISTORY
+ *
+ * File Name: temp_history.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the in-RAM temperature history: a ring buffer of
+ *              timestamped samples and a decimated long-term tier per channel,
+ *              with sliding window statistics updated in O(1) per sample.
+ *
+ *******************************************************************************/
+
+#ifndef TEMP_HISTORY_H_
+#define TEMP_HISTORY_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations, about 600 bytes of SRAM per channel */
+#define TEMP_HISTORY_NUM_OF_CHANNELS             1
+#define TEMP_HISTORY_CONTROL_CHANNEL             0
+#define TEMP_HISTORY_SAMPLE_PERIOD_S             2
+#define TEMP_HISTORY_RAW_LENGTH                  30       /* 1 minute of raw samples */
+#define TEMP_HISTORY_LONG_LENGTH                 60       /* 1 hour of one minute summaries */
+
+/* Parameters Definitions */
+#define TEMP_HISTORY_LONG_PERIOD_S               (TEMP_HISTORY_SAMPLE_PERIOD_S * TEMP_HISTORY_RAW_LENGTH)
+#define TEMP_HISTORY_MEAN_SHIFT                  8        /* Mean and variance are Q8.8 */
+
+#if ((TEMP_HISTORY_RAW_LENGTH > 255) || (TEMP_HISTORY_LONG_LENGTH > 255))
+#error "The history windows are indexed with 8 bits"
+#endif
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	TEMP_HISTORY_RAW, TEMP_HISTORY_LONG
+} TempHistory_TierType;
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/* One record of the dump, a raw sample has the same min, mean and max */
+typedef struct{
+	uint16 time;                       /* s since power on, wraps after 18 hours */
+	uint8 min;                         /* C */
+	uint8 mean;                        /* C */
+	uint8 max;                         /* C */
+} TempHistory_RecordType;
+
+typedef struct{
+	uint8 count;                       /* Records in the window */
+	uint8 min;                         /* C */
+	uint8 max;                         /* C */
+	uint16 mean;                       /* C in Q8.8 */
+	uint32 variance;                   /* C^2 in Q8.8 */
+} TempHistory_StatsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Empty both tiers of all the channels.
+ */
+void TempHistory_init (void);
+
+/*
+ * Description :
+ * Empty both tiers of the given channel.
+ */
+void TempHistory_clear (uint8 channel);
+
+/*
+ * Description :
+ * Called every loop iteration with the latest temperature of the channel, a sample
+ * is only stored every TEMP_HISTORY_SAMPLE_PERIOD_S of the system tick.
+ */
+void TempHistory_update (uint8 channel, uint8 temperature);
+
+/*
+ * Description :
+ * Store one sample taken at the given time in the raw tier, each full raw window
+ * adds its min/mean/max summary to the long-term tier.
+ */
+void TempHistory_addSample (uint8 channel, uint16 time, uint8 temperature);
+
+/*
+ * Description :
+ * Copy the statistics of the whole window of the given tier.
+ * Returns FALSE if the channel is wrong or the window is still empty.
+ */
+bool TempHistory_getStats (uint8 channel, TempHistory_TierType tier, TempHistory_StatsType * Stats_Ptr);
+
+/*
+ * Description :
+ * Bulk dump: copy up to maxRecords records of the tier, oldest first, starting
+ * from the given position in the window.
+ * Returns the number of copied records.
+ */
+uint8 TempHistory_dump (uint8 channel, TempHistory_TierType tier, uint8 first,
+		TempHistory_RecordType * Records_Ptr, uint8 maxRecords);
+
+#endif /* TEMP_HISTORY_H_ */
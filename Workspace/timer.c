@@ -0,0 +1,427 @@
+/******************************************************************************
+ *
+ * Module: TIMER
+ *
+ * File Name: timer.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the generic driver of the ATmega32 Timer0, Timer1 and Timer2
+ *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include "common_macros.h"
+#include "timer.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define TIMER_INVALID                            0xFF
+#define TIMER_CLOCK_MASK                         0x07
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static void (*volatile g_callBackPtr[NUM_OF_TIMERS][TIMER_NUM_OF_EVENTS])(void);
+
+/* CS bits of every prescaler, Timer0 and Timer1 share the same coding */
+static const uint8 g_clockSelect[NUM_OF_TIMERS][TIMER_EXTERNAL_RISING + 1] = {
+	{0, 1, 2, TIMER_INVALID, 3, TIMER_INVALID, 4, 5, 6, 7},
+	{0, 1, 2, TIMER_INVALID, 3, TIMER_INVALID, 4, 5, 6, 7},
+	{0, 1, 2, 3, 4, 5, 6, 7, TIMER_INVALID, TIMER_INVALID}
+};
+
+/* TIMSK / TIFR bit of every event, both registers share the same layout */
+static const uint8 g_interruptBit[NUM_OF_TIMERS][TIMER_NUM_OF_EVENTS] = {
+	{TOIE0, OCIE0, TIMER_INVALID, TIMER_INVALID},
+	{TOIE1, OCIE1A, OCIE1B, TICIE1},
+	{TOIE2, OCIE2, TIMER_INVALID, TIMER_INVALID}
+};
+
+/*******************************************************************************
+ *                       Interrupt Service Routines                            *
+ *******************************************************************************/
+ISR(TIMER0_OVF_vect)
+{
+	if (g_callBackPtr[TIMER0_ID][TIMER_EVENT_OVERFLOW] != NULL_PTR)
+	{
+		(*g_callBackPtr[TIMER0_ID][TIMER_EVENT_OVERFLOW])();
+	}
+}
+
+ISR(TIMER0_COMP_vect)
+{
+	if (g_callBackPtr[TIMER0_ID][TIMER_EVENT_COMPARE_A] != NULL_PTR)
+	{
+		(*g_callBackPtr[TIMER0_ID][TIMER_EVENT_COMPARE_A])();
+	}
+}
+
+ISR(TIMER1_OVF_vect)
+{
+	if (g_callBackPtr[TIMER1_ID][TIMER_EVENT_OVERFLOW] != NULL_PTR)
+	{
+		(*g_callBackPtr[TIMER1_ID][TIMER_EVENT_OVERFLOW])();
+	}
+}
+
+ISR(TIMER1_COMPA_vect)
+{
+	if (g_callBackPtr[TIMER1_ID][TIMER_EVENT_COMPARE_A] != NULL_PTR)
+	{
+		(*g_callBackPtr[TIMER1_ID][TIMER_EVENT_COMPARE_A])();
+	}
+}
+
+ISR(TIMER1_COMPB_vect)
+{
+	if (g_callBackPtr[TIMER1_ID][TIMER_EVENT_COMPARE_B] != NULL_PTR)
+	{
+		(*g_callBackPtr[TIMER1_ID][TIMER_EVENT_COMPARE_B])();
+	}
+}
+
+ISR(TIMER1_CAPT_vect)
+{
+	if (g_callBackPtr[TIMER1_ID][TIMER_EVENT_CAPTURE] != NULL_PTR)
+	{
+		(*g_callBackPtr[TIMER1_ID][TIMER_EVENT_CAPTURE])();
+	}
+}
+
+ISR(TIMER2_OVF_vect)
+{
+	if (g_callBackPtr[TIMER2_ID][TIMER_EVENT_OVERFLOW] != NULL_PTR)
+	{
+		(*g_callBackPtr[TIMER2_ID][TIMER_EVENT_OVERFLOW])();
+	}
+}
+
+ISR(TIMER2_COMP_vect)
+{
+	if (g_callBackPtr[TIMER2_ID][TIMER_EVENT_COMPARE_A] != NULL_PTR)
+	{
+		(*g_callBackPtr[TIMER2_ID][TIMER_EVENT_COMPARE_A])();
+	}
+}
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* TCCR0 / TCCR2 value without the clock bits, both timers share the same layout */
+static uint8 Timer_control8Bit (const Timer_ConfigType * Config_Ptr)
+{
+	uint8 control = (uint8)((Config_Ptr -> output[TIMER_CHANNEL_A] & 0x03) << COM00);
+
+	switch (Config_Ptr -> mode)
+	{
+	case TIMER_CTC_MODE:
+		control |= (1 << FOC0) | (1 << WGM01);
+		break;
+	case TIMER_FAST_PWM_MODE:
+		control |= (1 << WGM00) | (1 << WGM01);
+		break;
+	case TIMER_PHASE_CORRECT_PWM_MODE:
+		control |= (1 << WGM00);
+		break;
+	default:
+		control |= (1 << FOC0);                /* FOC is only allowed in the non-PWM modes */
+		break;
+	}
+	return control;
+}
+
+static void Timer_setupOutputPin (Timer_OutputType output, uint8 port, uint8 pin)
+{
+	if (output != TIMER_OUTPUT_DISCONNECTED)
+	{
+		GPIO_setupPinDirection (port, pin, PIN_OUTPUT);
+	}
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * 1. Stop the timer then set its mode, compare values and output pin behavior.
+ * 2. Set the used output compare pins as outputs through the GPIO driver.
+ * 3. Clear the old flags of the requested interrupts and enable them, the other
+ *    interrupts of this timer are disabled.
+ * 4. Start the counter from zero with the required prescaler.
+ * Returns FALSE without touching the timer if the configuration does not exist on it.
+ */
+bool Timer_init (Timer_IdType timer, const Timer_ConfigType * Config_Ptr)
+{
+	uint8 clock;
+	uint8 event;
+
+	if (timer >= NUM_OF_TIMERS)
+	{
+		return FALSE;
+	}
+	clock = g_clockSelect[timer][Config_Ptr -> prescaler];
+	if (clock == TIMER_INVALID)
+	{
+		return FALSE;
+	}
+
+	Timer_deinit (timer);
+	switch (timer)
+	{
+	case TIMER0_ID:
+		TCCR0 = Timer_control8Bit (Config_Ptr);
+		TCNT0 = 0;
+		OCR0 = (uint8)Config_Ptr -> compare[TIMER_CHANNEL_A];
+		Timer_setupOutputPin (Config_Ptr -> output[TIMER_CHANNEL_A], TIMER0_OC_PORT_ID, TIMER0_OC_PIN_ID);
+		TCCR0 |= clock;
+		break;
+
+	case TIMER1_ID:
+		/* WGM13:10 = 0 normal, 4 CTC with OCR1A as TOP, 14 fast PWM and 10 phase correct PWM with ICR1 as TOP */
+		TCCR1A = (uint8)(((Config_Ptr -> output[TIMER_CHANNEL_A] & 0x03) << COM1A0) |
+				((Config_Ptr -> output[TIMER_CHANNEL_B] & 0x03) << COM1B0));
+		TCCR1B = (Config_Ptr -> captureEdge == TIMER_CAPTURE_RISING) ? (1 << ICES1) : 0;
+		switch (Config_Ptr -> mode)
+		{
+		case TIMER_CTC_MODE:
+			TCCR1A |= (1 << FOC1A) | (1 << FOC1B);
+			TCCR1B |= (1 << WGM12);
+			break;
+		case TIMER_FAST_PWM_MODE:
+			TCCR1A |= (1 << WGM11);
+			TCCR1B |= (1 << WGM13) | (1 << WGM12);
+			break;
+		case TIMER_PHASE_CORRECT_PWM_MODE:
+			TCCR1A |= (1 << WGM11);
+			TCCR1B |= (1 << WGM13);
+			break;
+		default:
+			TCCR1A |= (1 << FOC1A) | (1 << FOC1B);
+			break;
+		}
+		TCNT1 = 0;
+		ICR1 = Config_Ptr -> top;
+		OCR1A = Config_Ptr -> compare[TIMER_CHANNEL_A];
+		OCR1B = Config_Ptr -> compare[TIMER_CHANNEL_B];
+		Timer_setupOutputPin (Config_Ptr -> output[TIMER_CHANNEL_A], TIMER1_OCA_PORT_ID, TIMER1_OCA_PIN_ID);
+		Timer_setupOutputPin (Config_Ptr -> output[TIMER_CHANNEL_B], TIMER1_OCB_PORT_ID, TIMER1_OCB_PIN_ID);
+		TCCR1B |= clock;
+		break;
+
+	default:
+		TCCR2 = Timer_control8Bit (Config_Ptr);
+		TCNT2 = 0;
+		OCR2 = (uint8)Config_Ptr -> compare[TIMER_CHANNEL_A];
+		Timer_setupOutputPin (Config_Ptr -> output[TIMER_CHANNEL_A], TIMER2_OC_PORT_ID, TIMER2_OC_PIN_ID);
+		TCCR2 |= clock;
+		break;
+	}
+
+	for (event = 0; event < TIMER_NUM_OF_EVENTS; event++)
+	{
+		if (Config_Ptr -> interrupts & TIMER_INTERRUPT (event))
+		{
+			Timer_enableInterrupt (timer, (Timer_EventType)event);
+		}
+	}
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Stop the clock of the timer and disable its interrupts.
+ */
+void Timer_deinit (Timer_IdType timer)
+{
+	uint8 event;
+
+	switch (timer)
+	{
+	case TIMER0_ID:
+		TCCR0 &= (uint8)(~TIMER_CLOCK_MASK);
+		break;
+	case TIMER1_ID:
+		TCCR1B &= (uint8)(~TIMER_CLOCK_MASK);
+		break;
+	case TIMER2_ID:
+		TCCR2 &= (uint8)(~TIMER_CLOCK_MASK);
+		break;
+	default:
+		return;
+	}
+	for (event = 0; event < TIMER_NUM_OF_EVENTS; event++)
+	{
+		Timer_disableInterrupt (timer, (Timer_EventType)event);
+	}
+}
+
+/*
+ * Description :
+ * Save the address of the function called from the interrupt of the given event,
+ * it runs with the interrupts disabled so it must be short.
+ */
+void Timer_setCallBack (Timer_IdType timer, Timer_EventType event, void (*a_ptr)(void))
+{
+	if ((timer < NUM_OF_TIMERS) && (event < TIMER_NUM_OF_EVENTS))
+	{
+		g_callBackPtr[timer][event] = a_ptr;
+	}
+}
+
+/*
+ * Description :
+ * Clear the old flag of the event and enable its interrupt, or disable it.
+ * Both update TIMSK atomically, so they can be called from an ISR too.
+ */
+void Timer_enableInterrupt (Timer_IdType timer, Timer_EventType event)
+{
+	uint8 bit;
+
+	if ((timer < NUM_OF_TIMERS) && (event < TIMER_NUM_OF_EVENTS))
+	{
+		bit = g_interruptBit[timer][event];
+		if (bit != TIMER_INVALID)
+		{
+			ATOMIC_BLOCK (ATOMIC_RESTORESTATE)
+			{
+				TIFR = (uint8)(1 << bit);      /* Clear the old flag by putting logic high, the others are kept */
+				SET_BIT (TIMSK, bit);
+			}
+		}
+	}
+}
+
+void Timer_disableInterrupt (Timer_IdType timer, Timer_EventType event)
+{
+	uint8 bit;
+
+	if ((timer < NUM_OF_TIMERS) && (event < TIMER_NUM_OF_EVENTS))
+	{
+		bit = g_interruptBit[timer][event];
+		if (bit != TIMER_INVALID)
+		{
+			ATOMIC_BLOCK (ATOMIC_RESTORESTATE)
+			{
+				CLEAR_BIT (TIMSK, bit);
+			}
+		}
+	}
+}
+
+/*
+ * Description :
+ * Clear the flag of the event without enabling its interrupt, e.g. to re-arm the
+ * ADC auto-trigger on it (a conversion starts on the rising edge of the flag).
+ */
+void Timer_clearFlag (Timer_IdType timer, Timer_EventType event)
+{
+	if ((timer < NUM_OF_TIMERS) && (event < TIMER_NUM_OF_EVENTS) && (g_interruptBit[timer][event] != TIMER_INVALID))
+	{
+		TIFR = (uint8)(1 << g_interruptBit[timer][event]);
+	}
+}
+
+/*
+ * Description :
+ * Return TRUE if the timer has a clock selected, so its events happen.
+ */
+bool Timer_isRunning (Timer_IdType timer)
+{
+	switch (timer)
+	{
+	case TIMER0_ID:
+		return ((TCCR0 & TIMER_CLOCK_MASK) != 0);
+	case TIMER1_ID:
+		return ((TCCR1B & TIMER_CLOCK_MASK) != 0);
+	case TIMER2_ID:
+		return ((TCCR2 & TIMER_CLOCK_MASK) != 0);
+	default:
+		return FALSE;
+	}
+}
+
+/*
+ * Description :
+ * Write a compare value of the timer. The 16-bit registers of Timer1 share a temporary
+ * byte, call it with the interrupts disabled if an interrupt also accesses Timer1.
+ */
+void Timer_setCompare (Timer_IdType timer, Timer_ChannelType channel, uint16 value)
+{
+	switch (timer)
+	{
+	case TIMER0_ID:
+		OCR0 = (uint8)value;
+		break;
+	case TIMER1_ID:
+		if (channel == TIMER_CHANNEL_B)
+		{
+			OCR1B = value;
+		}
+		else
+		{
+			OCR1A = value;
+		}
+		break;
+	case TIMER2_ID:
+		OCR2 = (uint8)value;
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+ * Description :
+ * Return a compare value of the timer, same note as Timer_setCompare for Timer1.
+ * With a double buffered compare register (PWM modes) this is the buffered value.
+ */
+uint16 Timer_getCompare (Timer_IdType timer, Timer_ChannelType channel)
+{
+	switch (timer)
+	{
+	case TIMER0_ID:
+		return OCR0;
+	case TIMER1_ID:
+		return (channel == TIMER_CHANNEL_B) ? OCR1B : OCR1A;
+	case TIMER2_ID:
+		return OCR2;
+	default:
+		return 0;
+	}
+}
+
+/*
+ * Description :
+ * Return the counter of the timer, same note as Timer_setCompare for Timer1.
+ */
+uint16 Timer_getCount (Timer_IdType timer)
+{
+	switch (timer)
+	{
+	case TIMER0_ID:
+		return TCNT0;
+	case TIMER1_ID:
+		return TCNT1;
+	case TIMER2_ID:
+		return TCNT2;
+	default:
+		return 0;
+	}
+}
+
+/*
+ * Description :
+ * Return the counter of Timer1 latched by the last input capture event.
+ */
+uint16 Timer_getCapture (void)
+{
+	return ICR1;
+}
@@ -0,0 +1,207 @@
+/******************************************************************************
+ *
+ * Module: TIMER
+ *
+ * File Name: timer.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the generic driver of the ATmega32 Timer0, Timer1 and Timer2
+ *
+ *******************************************************************************/
+
+#ifndef TIMER_H_
+#define TIMER_H_
+
+#include "std_types.h"
+#include "gpio.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Parameters Definitions */
+#define TIMER_8_BIT_MAX_TOP                      255UL
+#define TIMER_16_BIT_MAX_TOP                     65535UL
+#define TIMER_INTERRUPT(EVENT)                   ((uint8)(1 << (EVENT)))
+
+/* Output compare pins */
+#define TIMER0_OC_PORT_ID                        PORTB_ID
+#define TIMER0_OC_PIN_ID                         PIN3_ID
+#define TIMER1_OCA_PORT_ID                       PORTD_ID
+#define TIMER1_OCA_PIN_ID                        PIN5_ID
+#define TIMER1_OCB_PORT_ID                       PORTD_ID
+#define TIMER1_OCB_PIN_ID                        PIN4_ID
+#define TIMER2_OC_PORT_ID                        PORTD_ID
+#define TIMER2_OC_PIN_ID                         PIN7_ID
+
+/*
+ * Compile time frequency helpers, usable in #if to validate a configuration:
+ * TIMER_COUNTS is the rounded number of timer clocks in one period of the frequency
+ * with the clock divided by DIVISION, TIMER_TOP the matching CTC / PWM TOP value.
+ * TIMER_DIVISION picks the smallest division of Timer0 / Timer1 whose TOP fits
+ * MAX_TOP (the best resolution), TIMER2_DIVISION does the same with the extra
+ * divisions of Timer2. Check the result with TIMER_TOP(...) > MAX_TOP.
+ */
+#define TIMER_COUNTS(FREQ_HZ, DIVISION)          ((F_CPU + ((DIVISION) * (FREQ_HZ)) / 2) / ((DIVISION) * (FREQ_HZ)))
+#define TIMER_TOP(FREQ_HZ, DIVISION)             (TIMER_COUNTS (FREQ_HZ, DIVISION) - 1)
+#define TIMER_FITS(FREQ_HZ, DIVISION, MAX_TOP)   ((TIMER_COUNTS (FREQ_HZ, DIVISION) >= 1) && (TIMER_TOP (FREQ_HZ, DIVISION) <= (MAX_TOP)))
+
+#define TIMER_DIVISION(FREQ_HZ, MAX_TOP) \
+	(TIMER_FITS (FREQ_HZ, 1UL, MAX_TOP) ? 1UL : \
+	 TIMER_FITS (FREQ_HZ, 8UL, MAX_TOP) ? 8UL : \
+	 TIMER_FITS (FREQ_HZ, 64UL, MAX_TOP) ? 64UL : \
+	 TIMER_FITS (FREQ_HZ, 256UL, MAX_TOP) ? 256UL : 1024UL)
+
+#define TIMER2_DIVISION(FREQ_HZ, MAX_TOP) \
+	(TIMER_FITS (FREQ_HZ, 1UL, MAX_TOP) ? 1UL : \
+	 TIMER_FITS (FREQ_HZ, 8UL, MAX_TOP) ? 8UL : \
+	 TIMER_FITS (FREQ_HZ, 32UL, MAX_TOP) ? 32UL : \
+	 TIMER_FITS (FREQ_HZ, 64UL, MAX_TOP) ? 64UL : \
+	 TIMER_FITS (FREQ_HZ, 128UL, MAX_TOP) ? 128UL : \
+	 TIMER_FITS (FREQ_HZ, 256UL, MAX_TOP) ? 256UL : 1024UL)
+
+/* Prescaler of a clock division computed above */
+#define TIMER_PRESCALER_OF(DIVISION) \
+	(((DIVISION) == 1UL) ? TIMER_F_CPU_1 : ((DIVISION) == 8UL) ? TIMER_F_CPU_8 : \
+	 ((DIVISION) == 32UL) ? TIMER_F_CPU_32 : ((DIVISION) == 64UL) ? TIMER_F_CPU_64 : \
+	 ((DIVISION) == 128UL) ? TIMER_F_CPU_128 : ((DIVISION) == 256UL) ? TIMER_F_CPU_256 : TIMER_F_CPU_1024)
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	TIMER0_ID, TIMER1_ID, TIMER2_ID, NUM_OF_TIMERS
+} Timer_IdType;
+
+/*
+ * CTC counts from 0 to compareA on every timer. The PWM modes of the 8-bit timers
+ * count up to 255, the ones of Timer1 up to the top value of the configuration (ICR1).
+ */
+typedef enum
+{
+	TIMER_NORMAL_MODE, TIMER_CTC_MODE, TIMER_FAST_PWM_MODE, TIMER_PHASE_CORRECT_PWM_MODE
+} Timer_ModeType;
+
+/* F_CPU_32 and F_CPU_128 exist on Timer2 only, the external clocks on Timer0 and Timer1 only */
+typedef enum
+{
+	TIMER_NO_CLOCK, TIMER_F_CPU_1, TIMER_F_CPU_8, TIMER_F_CPU_32, TIMER_F_CPU_64, TIMER_F_CPU_128,
+	TIMER_F_CPU_256, TIMER_F_CPU_1024, TIMER_EXTERNAL_FALLING, TIMER_EXTERNAL_RISING
+} Timer_PrescalerType;
+
+/* Compare match behavior of an output pin, CLEAR is the non-inverting PWM and SET the inverting one */
+typedef enum
+{
+	TIMER_OUTPUT_DISCONNECTED, TIMER_OUTPUT_TOGGLE, TIMER_OUTPUT_CLEAR, TIMER_OUTPUT_SET
+} Timer_OutputType;
+
+/* The 8-bit timers only have channel A (OC0 / OC2) */
+typedef enum
+{
+	TIMER_CHANNEL_A, TIMER_CHANNEL_B, TIMER_NUM_OF_CHANNELS
+} Timer_ChannelType;
+
+/* Compare A is the single compare of the 8-bit timers, the input capture exists on Timer1 only */
+typedef enum
+{
+	TIMER_EVENT_OVERFLOW, TIMER_EVENT_COMPARE_A, TIMER_EVENT_COMPARE_B, TIMER_EVENT_CAPTURE, TIMER_NUM_OF_EVENTS
+} Timer_EventType;
+
+typedef enum
+{
+	TIMER_CAPTURE_FALLING, TIMER_CAPTURE_RISING
+} Timer_CaptureEdgeType;
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	Timer_ModeType mode;
+	Timer_PrescalerType prescaler;
+	uint16 top;                                  /* PWM TOP of Timer1 (ICR1), unused by the other modes and timers */
+	uint16 compare[TIMER_NUM_OF_CHANNELS];       /* Compare values, channel B on Timer1 only */
+	Timer_OutputType output[TIMER_NUM_OF_CHANNELS];
+	uint8 interrupts;                            /* Mask of TIMER_INTERRUPT(event) to enable */
+	Timer_CaptureEdgeType captureEdge;           /* Timer1 input capture (ICP1 on PD6) */
+} Timer_ConfigType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * 1. Stop the timer then set its mode, compare values and output pin behavior.
+ * 2. Set the used output compare pins as outputs through the GPIO driver.
+ * 3. Clear the old flags of the requested interrupts and enable them, the other
+ *    interrupts of this timer are disabled.
+ * 4. Start the counter from zero with the required prescaler.
+ * Returns FALSE without touching the timer if the configuration does not exist on it.
+ */
+bool Timer_init (Timer_IdType timer, const Timer_ConfigType * Config_Ptr);
+
+/*
+ * Description :
+ * Stop the clock of the timer and disable its interrupts.
+ */
+void Timer_deinit (Timer_IdType timer);
+
+/*
+ * Description :
+ * Save the address of the function called from the interrupt of the given event,
+ * it runs with the interrupts disabled so it must be short.
+ */
+void Timer_setCallBack (Timer_IdType timer, Timer_EventType event, void (*a_ptr)(void));
+
+/*
+ * Description :
+ * Clear the old flag of the event and enable its interrupt, or disable it.
+ * Both update TIMSK atomically, so they can be called from an ISR too.
+ */
+void Timer_enableInterrupt (Timer_IdType timer, Timer_EventType event);
+void Timer_disableInterrupt (Timer_IdType timer, Timer_EventType event);
+
+/*
+ * Description :
+ * Clear the flag of the event without enabling its interrupt, e.g. to re-arm the
+ * ADC auto-trigger on it (a conversion starts on the rising edge of the flag).
+ */
+void Timer_clearFlag (Timer_IdType timer, Timer_EventType event);
+
+/*
+ * Description :
+ * Return TRUE if the timer has a clock selected, so its events happen.
+ */
+bool Timer_isRunning (Timer_IdType timer);
+
+/*
+ * Description :
+ * Write a compare value of the timer. The 16-bit registers of Timer1 share a temporary
+ * byte, call it with the interrupts disabled if an interrupt also accesses Timer1.
+ */
+void Timer_setCompare (Timer_IdType timer, Timer_ChannelType channel, uint16 value);
+
+/*
+ * Description :
+ * Return a compare value of the timer, same note as Timer_setCompare for Timer1.
+ * With a double buffered compare register (PWM modes) this is the buffered value.
+ */
+uint16 Timer_getCompare (Timer_IdType timer, Timer_ChannelType channel);
+
+/*
+ * Description :
+ * Return the counter of the timer, same note as Timer_setCompare for Timer1.
+ */
+uint16 Timer_getCount (Timer_IdType timer);
+
+/*
+ * Description :
+ * Return the counter of Timer1 latched by the last input capture event.
+ */
+uint16 Timer_getCapture (void);
+
+#endif /* TIMER_H_ */
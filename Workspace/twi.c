@@ -0,0 +1,162 @@
+/******************************************************************************
+ *
+ * Module: TWI
+ *
+ * File Name: twi.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the interrupt driven TWI (I2C) master driver.
+ *              A transfer is started and then runs byte by byte from the TWI
+ *              interrupt while the caller polls its status.
+ *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/twi.h>
+#include "twi.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* TWCR values, TWINT is written 1 to clear the flag and let the hardware go on */
+#define TWI_CONTINUE                             ((1 << TWINT) | (1 << TWEN) | (1 << TWIE))
+#define TWI_SEND_START                           (TWI_CONTINUE | (1 << TWSTA))
+#define TWI_SEND_STOP                            ((1 << TWINT) | (1 << TWEN) | (1 << TWSTO))
+#define TWI_ACK                                  (TWI_CONTINUE | (1 << TWEA))
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static volatile TWI_StatusType g_status = TWI_IDLE;
+static volatile uint8 g_address = 0;
+static const uint8 * volatile g_txData = NULL_PTR;
+static uint8 * volatile g_rxData = NULL_PTR;
+static volatile uint8 g_txLength = 0;
+static volatile uint8 g_rxLength = 0;
+static volatile uint8 g_index = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void TWI_finish (TWI_StatusType status)
+{
+	TWCR = TWI_SEND_STOP;                      /* Release the bus, the stop needs no interrupt */
+	g_status = status;
+}
+
+/*******************************************************************************
+ *                       Interrupt Service Routines                            *
+ *******************************************************************************/
+ISR(TWI_vect)
+{
+	switch (TW_STATUS)
+	{
+	case TW_START:
+	case TW_REP_START:
+		g_index = 0;
+		/* The write part first, the read part after the repeated start */
+		if ((g_txLength != 0) && (g_txData != NULL_PTR))
+		{
+			TWDR = (uint8)(g_address << 1) | TW_WRITE;
+		}
+		else
+		{
+			TWDR = (uint8)(g_address << 1) | TW_READ;
+		}
+		TWCR = TWI_CONTINUE;
+		break;
+
+	case TW_MT_SLA_ACK:
+	case TW_MT_DATA_ACK:
+		if (g_index < g_txLength)
+		{
+			TWDR = g_txData[g_index++];
+			TWCR = TWI_CONTINUE;
+		}
+		else if (g_rxLength != 0)
+		{
+			g_txData = NULL_PTR;               /* Marks the write part as done for the repeated start */
+			TWCR = TWI_SEND_START;
+		}
+		else
+		{
+			TWI_finish (TWI_DONE);
+		}
+		break;
+
+	case TW_MR_SLA_ACK:
+		/* NACK the last byte to tell the slave the read is over */
+		TWCR = (g_rxLength > 1) ? TWI_ACK : TWI_CONTINUE;
+		break;
+
+	case TW_MR_DATA_ACK:
+		g_rxData[g_index++] = TWDR;
+		TWCR = (g_index + 1 < g_rxLength) ? TWI_ACK : TWI_CONTINUE;
+		break;
+
+	case TW_MR_DATA_NACK:
+		g_rxData[g_index] = TWDR;
+		TWI_finish (TWI_DONE);
+		break;
+
+	default:
+		/* Address or data not acknowledged, arbitration lost or bus error */
+		TWI_finish (TWI_ERROR);
+		break;
+	}
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Setup the bit rate and enable the TWI module, any transfer in progress is dropped.
+ * SCL (PC0) and SDA (PC1) need external pull-up resistors.
+ */
+void TWI_init (void)
+{
+	TWCR = 0;                                  /* Reset the module, clears a stuck transfer */
+	TWBR = TWI_BIT_RATE;
+	TWSR = 0;                                  /* Prescaler 1 by making TWPS0 = 0 & TWPS1 = 0 */
+	TWCR = (1 << TWEN);
+	g_status = TWI_IDLE;
+}
+
+/*
+ * Description :
+ * Start a transfer to the 7-bit address: write txLength bytes then, after a repeated
+ * start, read rxLength bytes. Either length can be zero. The buffers must stay valid
+ * until the transfer is done.
+ * Returns FALSE if another transfer is still running.
+ */
+bool TWI_startTransfer (uint8 address, const uint8 * txData, uint8 txLength, uint8 * rxData, uint8 rxLength)
+{
+	if ((g_status == TWI_BUSY) || ((txLength == 0) && (rxLength == 0)))
+	{
+		return FALSE;
+	}
+	g_address = address;
+	g_txData = txData;
+	g_txLength = txLength;
+	g_rxData = rxData;
+	g_rxLength = rxLength;
+	g_status = TWI_BUSY;
+	TWCR = TWI_SEND_START;
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Return the status of the last transfer, DONE and ERROR are kept until the next one starts.
+ */
+TWI_StatusType TWI_getStatus (void)
+{
+	return g_status;
+}
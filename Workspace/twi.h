@@ -0,0 +1,63 @@
+/******************************************************************************
+ *
+ * Module: TWI
+ *
+ * File Name: twi.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the interrupt driven TWI (I2C) master driver.
+ *              A transfer is started and then runs byte by byte from the TWI
+ *              interrupt while the caller polls its status.
+ *
+ *******************************************************************************/
+
+#ifndef TWI_H_
+#define TWI_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations, SCL = F_CPU / (16 + 2 * TWBR * 4^TWPS), about 28 kHz at 1 MHz */
+#define TWI_BIT_RATE                             10       /* The lowest value allowed for a master */
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	TWI_IDLE, TWI_BUSY, TWI_DONE, TWI_ERROR
+} TWI_StatusType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Setup the bit rate and enable the TWI module, any transfer in progress is dropped.
+ * SCL (PC0) and SDA (PC1) need external pull-up resistors.
+ */
+void TWI_init (void);
+
+/*
+ * Description :
+ * Start a transfer to the 7-bit address: write txLength bytes then, after a repeated
+ * start, read rxLength bytes. Either length can be zero. The buffers must stay valid
+ * until the transfer is done.
+ * Returns FALSE if another transfer is still running.
+ */
+bool TWI_startTransfer (uint8 address, const uint8 * txData, uint8 txLength, uint8 * rxData, uint8 rxLength);
+
+/*
+ * Description :
+ * Return the status of the last transfer, DONE and ERROR are kept until the next one starts.
+ */
+TWI_StatusType TWI_getStatus (void);
+
+#endif /* TWI_H_ */
@@ -0,0 +1,160 @@
+/******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: uart.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the interrupt driven ATmega32 USART driver (RXD PD0, TXD PD1)
+ *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "common_macros.h"
+#include "uart.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+static void (*volatile g_rxCallBackPtr)(uint8 data, uint8 errors) = NULL_PTR;
+static void (*volatile g_txDoneCallBackPtr)(void) = NULL_PTR;
+
+/* Transmission in progress, written by UART_send then only by the interrupts */
+static const uint8 * volatile g_txData = NULL_PTR;
+static volatile uint8 g_txRemaining = 0;
+static volatile bool g_txBusy = FALSE;
+
+/*******************************************************************************
+ *                       Interrupt Service Routines                            *
+ *******************************************************************************/
+ISR(USART_RXC_vect)
+{
+	/* The error flags belong to the byte in UDR, so they must be read before it */
+	uint8 status = UCSRA;
+	uint8 data = UDR;
+	uint8 errors = 0;
+
+	if (BIT_IS_SET (status, FE))
+	{
+		errors |= UART_ERROR_FRAME;
+	}
+	if (BIT_IS_SET (status, DOR))
+	{
+		errors |= UART_ERROR_OVERRUN;
+	}
+	if (BIT_IS_SET (status, PE))
+	{
+		errors |= UART_ERROR_PARITY;
+	}
+	if (g_rxCallBackPtr != NULL_PTR)
+	{
+		(*g_rxCallBackPtr)(data, errors);
+	}
+}
+
+ISR(USART_UDRE_vect)
+{
+	if (g_txRemaining == 0)
+	{
+		/* Everything is in the shift register, wait for the transmit complete interrupt */
+		CLEAR_BIT (UCSRB, UDRIE);
+		SET_BIT (UCSRA, TXC);                  /* Clear an old flag by putting logic high */
+		SET_BIT (UCSRB, TXCIE);
+		return;
+	}
+	UDR = *g_txData;
+	g_txData++;
+	g_txRemaining--;
+}
+
+ISR(USART_TXC_vect)
+{
+	CLEAR_BIT (UCSRB, TXCIE);
+	g_txBusy = FALSE;
+	if (g_txDoneCallBackPtr != NULL_PTR)
+	{
+		(*g_txDoneCallBackPtr)();
+	}
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * 1. Setup the frame format and the baud rate in double speed mode.
+ * 2. Enable the receiver with its interrupt and the transmitter.
+ */
+void UART_init (const UART_ConfigType * Config_Ptr)
+{
+	uint16 ubrr = (uint16)UART_UBRR_VALUE (Config_Ptr -> baudRate);
+
+	UCSRB = 0;
+	UCSRA = (1 << U2X);                        /* Double speed mode */
+
+	/* URSEL = 1 to write UCSRC, asynchronous mode with 8 data bits UCSZ1 = 1 & UCSZ0 = 1 */
+	UCSRC = (1 << URSEL) | (uint8)((Config_Ptr -> parity & 0x03) << UPM0) |
+			(uint8)((Config_Ptr -> stopBits & 0x01) << USBS) | (1 << UCSZ1) | (1 << UCSZ0);
+
+	/* URSEL = 0 to write UBRRH, it shares its address with UCSRC */
+	UBRRH = (uint8)(ubrr >> 8) & 0x0F;
+	UBRRL = (uint8)ubrr;
+
+	g_txRemaining = 0;
+	g_txBusy = FALSE;
+	UCSRB = (1 << RXCIE) | (1 << RXEN) | (1 << TXEN);
+}
+
+/*
+ * Description :
+ * Save the address of the function called from the receive interrupt with every
+ * received byte and its UART_ERROR_* flags, it must be short.
+ */
+void UART_setRxCallBack (void (*a_ptr)(uint8 data, uint8 errors))
+{
+	g_rxCallBackPtr = a_ptr;
+}
+
+/*
+ * Description :
+ * Save the address of the function called from the interrupt once the last byte
+ * of a transmission has completely left the shift register (e.g. to release an
+ * RS-485 driver).
+ */
+void UART_setTxDoneCallBack (void (*a_ptr)(void))
+{
+	g_txDoneCallBackPtr = a_ptr;
+}
+
+/*
+ * Description :
+ * Start sending the given bytes from the data register empty interrupt without waiting.
+ * The buffer must stay unchanged until the transmission is done.
+ * Returns FALSE if a transmission is still running.
+ */
+bool UART_send (const uint8 * Data_Ptr, uint8 length)
+{
+	if (g_txBusy || (length == 0))
+	{
+		return FALSE;
+	}
+	g_txData = Data_Ptr;
+	g_txRemaining = length;
+	g_txBusy = TRUE;
+	SET_BIT (UCSRB, UDRIE);                    /* The interrupt fires at once as the data register is empty */
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Return TRUE while a transmission started by UART_send is running.
+ */
+bool UART_isBusy (void)
+{
+	return g_txBusy;
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: uart.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the interrupt driven ATmega32 USART driver (RXD PD0, TXD PD1)
+ *
+ *******************************************************************************/
+
+#ifndef UART_H_
+#define UART_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Parameters Definitions, the double speed mode gives the lowest baud rate error at 1 MHz */
+#define UART_UBRR_VALUE(BAUD)                    ((F_CPU + 4UL * (BAUD)) / (8UL * (BAUD)) - 1)
+#define UART_ACTUAL_BAUD(BAUD)                   (F_CPU / (8UL * (UART_UBRR_VALUE (BAUD) + 1)))
+
+/* Baud rate error in tenths of percent, above 20 (2 %) the frames are not reliable */
+#define UART_BAUD_ERROR(BAUD) \
+	(((UART_ACTUAL_BAUD (BAUD) > (BAUD)) ? (UART_ACTUAL_BAUD (BAUD) - (BAUD)) : ((BAUD) - UART_ACTUAL_BAUD (BAUD))) * 1000UL / (BAUD))
+
+/* Receive error flags given to the receive callback with the byte */
+#define UART_ERROR_FRAME                         0x01
+#define UART_ERROR_OVERRUN                       0x02
+#define UART_ERROR_PARITY                        0x04
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+typedef enum
+{
+	UART_PARITY_NONE, UART_PARITY_EVEN = 2, UART_PARITY_ODD
+} UART_ParityType;
+
+typedef enum
+{
+	UART_ONE_STOP_BIT, UART_TWO_STOP_BITS
+} UART_StopBitsType;
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+
+/* 8 data bits frames, check the baud rate with UART_BAUD_ERROR at compile time */
+typedef struct{
+	uint32 baudRate;
+	UART_ParityType parity;
+	UART_StopBitsType stopBits;
+} UART_ConfigType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * 1. Setup the frame format and the baud rate in double speed mode.
+ * 2. Enable the receiver with its interrupt and the transmitter.
+ */
+void UART_init (const UART_ConfigType * Config_Ptr);
+
+/*
+ * Description :
+ * Save the address of the function called from the receive interrupt with every
+ * received byte and its UART_ERROR_* flags, it must be short.
+ */
+void UART_setRxCallBack (void (*a_ptr)(uint8 data, uint8 errors));
+
+/*
+ * Description :
+ * Save the address of the function called from the interrupt once the last byte
+ * of a transmission has completely left the shift register (e.g. to release an
+ * RS-485 driver).
+ */
+void UART_setTxDoneCallBack (void (*a_ptr)(void));
+
+/*
+ * Description :
+ * Start sending the given bytes from the data register empty interrupt without waiting.
+ * The buffer must stay unchanged until the transmission is done.
+ * Returns FALSE if a transmission is still running.
+ */
+bool UART_send (const uint8 * Data_Ptr, uint8 length);
+
+/*
+ * Description :
+ * Return TRUE while a transmission started by UART_send is running.
+ */
+bool UART_isBusy (void);
+
+#endif /* UART_H_ */
@@ -0,0 +1,437 @@
+/******************************************************************************
+ *
+ * Module: UI
+ *
+ * File Name: ui.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the multi-page LCD user interface driven by the buttons
+ *
+ *******************************************************************************/
+
+#include <avr/pgmspace.h>
+#include "ui.h"
+#include "lcd.h"
+#include "bar_graph.h"
+#include "dc_motor.h"
+#include "fan_control.h"
+#include "autotune.h"
+#include "watchdog.h"
+#include "sensor.h"
+#include "stack_monitor.h"
+#include "sys_tick.h"
+#include "temp_history.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define UI_ALL_ROWS_MASK                         ((uint8)((1 << UI_NUM_OF_ROWS) - 1))
+#define UI_BAR_GRAPH_ROW_MASK                    ((uint8)(1 << BAR_GRAPH_ROW))
+#define UI_HISTORY_ROWS_MASK                     ((uint8)((1 << 1) | (1 << 2)))
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/*
+ * Fixed text of every row of every page, padded to the full row so drawing a row
+ * also erases the previous page. The empty status row is owned by the bar graph.
+ */
+static const char g_pageText[UI_NUM_OF_PAGES][UI_NUM_OF_ROWS][UI_ROW_LENGTH + 1] PROGMEM = {
+	{"                ", "   FAN IS       ", "  TEMP =     C  ", ""                },
+	{"     MIN AVG MAX", "1 MIN           ", "1 HR            ", "UP/DOWN: CLEAR  "},
+	{"    SETTINGS    ", "MIN SPEED    %  ", "                ", "UP/DOWN: CHANGE "},
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	{"AUTOTUNE        ", "CYCLES          ", "PERIOD         s", "UP:START DN:STOP"},
+#endif
+	{"LOOP MAX      ms", "STACK USED     B", "PWM SKIPS       ", "LCD SKIPS       "}
+};
+
+static UI_PageId g_page = UI_PAGE_STATUS;
+
+/* Rows of the current page whose fixed text is not drawn yet, their fields wait for them */
+static uint8 g_pendingRows = UI_ALL_ROWS_MASK;
+
+/* Value shown in each field of the current page, UI_NOT_DISPLAYED after a page change */
+static uint32 g_shownValues[UI_MAX_FIELDS_PER_PAGE];
+
+/* Profiling values sampled once per UI_STATS_REFRESH_MS so the stats page does not redraw every loop */
+static uint32 g_statsSnapshot[UI_MAX_FIELDS_PER_PAGE];
+static uint32 g_lastStatsTick = 0;
+
+static UI_StatsType g_stats = {0, 0, 0};
+
+/* The LCD and the bar graph glyphs are brought up by the updates, nothing is drawn before */
+static bool g_displayReady = FALSE;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return TRUE if the field must be redrawn with the given value and remember it as shown,
+ * a field of a row whose fixed text is still pending is drawn later.
+ */
+static bool UI_fieldChanged (uint8 field, uint8 row, uint32 value)
+{
+	if ((g_pendingRows & (1 << row)) || (g_shownValues[field] == value))
+	{
+		g_stats.fieldSkips++;
+		return FALSE;
+	}
+	g_shownValues[field] = value;
+	g_stats.fieldWrites++;
+	return TRUE;
+}
+
+/*
+ * Description :
+ * Draw the value right aligned in a field of the given width, saturated to the widest
+ * number which fits, so a shorter value also erases the digits of the previous one.
+ */
+static void UI_drawNumber (uint8 field, uint8 row, uint8 col, uint8 width, uint32 value)
+{
+	char buffer[UI_MAX_FIELD_WIDTH + 1];
+	uint8 i = width;
+
+	if (!UI_fieldChanged (field, row, value))
+	{
+		return;
+	}
+
+	buffer[width] = '\0';
+	do
+	{
+		i--;
+		buffer[i] = '0' + (value % 10);
+		value /= 10;
+	} while ((i > 0) && (value != 0));
+
+	if (value != 0)
+	{
+		/* Too wide for the field, show all nines */
+		for (i = 0; i < width; i++)
+		{
+			buffer[i] = '9';
+		}
+	}
+	else
+	{
+		while (i > 0)
+		{
+			buffer[--i] = ' ';
+		}
+	}
+
+	LCD_moveCursor (row, col);
+	LCD_displayString (buffer);
+}
+
+/*
+ * Description :
+ * Draw the fixed text of the first pending row of the current page.
+ */
+static void UI_drawPendingRow (void)
+{
+	uint8 row = 0;
+
+	while (!(g_pendingRows & (1 << row)))
+	{
+		row++;
+	}
+
+	if (pgm_read_byte (&g_pageText[g_page][row][0]) == '\0')
+	{
+		/* Widget row, the whole bar is redrawn on its next update */
+		BarGraph_invalidate ();
+	}
+	else
+	{
+		LCD_moveCursor (row, 0);
+		LCD_displayString_P (g_pageText[g_page][row]);
+		g_stats.rowWrites++;
+	}
+	g_pendingRows &= (uint8)(~(1 << row));
+}
+
+static void UI_renderStatus (uint8 temperature, uint8 speed)
+{
+	Watchdog_ResetInfoType resetInfo;
+
+	/* The top row stays blank unless the last reset was a missed loop deadline */
+	if (Watchdog_getResetInfo (&resetInfo))
+	{
+		if (UI_fieldChanged (2, 0, TRUE))
+		{
+			LCD_moveCursor (0, 0);
+			LCD_displayString_P (PSTR("DEADLINE RST"));
+		}
+		UI_drawNumber (3, 0, 13, 3, resetInfo.resetCount);
+	}
+
+	if (UI_fieldChanged (0, 1, (speed > DC_MIN_SPEED) ? TRUE : FALSE))
+	{
+		LCD_moveCursor (1, 10);
+		LCD_displayString_P ((speed > DC_MIN_SPEED) ? PSTR("ON ") : PSTR("OFF"));
+	}
+
+	/* No valid reading, either a sensor fault or above the 127 C of the Q8.8 range */
+	if (temperature == SENSOR_FAULT_TEMPERATURE)
+	{
+		if (UI_fieldChanged (1, 2, temperature))
+		{
+			LCD_moveCursor (2, 9);
+			LCD_displayString_P (PSTR("ERR"));
+		}
+	}
+	else
+	{
+		UI_drawNumber (1, 2, 9, 3, temperature);
+	}
+
+	/* The bar graph keeps its own cell cache */
+	if (!(g_pendingRows & UI_BAR_GRAPH_ROW_MASK))
+	{
+		BarGraph_update (speed);
+	}
+}
+
+static void UI_renderHistory (void)
+{
+	TempHistory_StatsType history;
+	uint8 row;
+
+	/* One row per tier, a tier without records stays blank */
+	for (row = 1; row <= 2; row++)
+	{
+		if (TempHistory_getStats (TEMP_HISTORY_CONTROL_CHANNEL, (row == 1) ? TEMP_HISTORY_RAW : TEMP_HISTORY_LONG, &history))
+		{
+			UI_drawNumber ((row - 1) * 3, row, 5, 3, history.min);
+			UI_drawNumber ((row - 1) * 3 + 1, row, 9, 3,
+					(history.mean + (1 << (TEMP_HISTORY_MEAN_SHIFT - 1))) >> TEMP_HISTORY_MEAN_SHIFT);
+			UI_drawNumber ((row - 1) * 3 + 2, row, 13, 3, history.max);
+		}
+	}
+}
+
+static void UI_renderSettings (void)
+{
+	UI_drawNumber (0, 1, 10, 3, FanControl_getMinSpeed ());
+}
+
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+static void UI_renderTune (void)
+{
+	Autotune_ResultType result;
+	Autotune_StateType state = Autotune_getState ();
+
+	if (UI_fieldChanged (0, 0, state))
+	{
+		LCD_moveCursor (0, 12);
+		switch (state)
+		{
+		case AUTOTUNE_RUNNING: LCD_displayString_P (PSTR("RUN ")); break;
+		case AUTOTUNE_DONE:    LCD_displayString_P (PSTR("DONE")); break;
+		case AUTOTUNE_FAILED:  LCD_displayString_P (PSTR("FAIL")); break;
+		default:               LCD_displayString_P (PSTR("IDLE")); break;
+		}
+	}
+	UI_drawNumber (1, 1, 13, 3, Autotune_getCycles ());
+
+	/* Oscillation period of the last successful tuning */
+	if (Autotune_getResult (&result))
+	{
+		UI_drawNumber (2, 2, 10, 5, result.periodTicks / SYS_TICK_MS_TO_TICKS (1000));
+	}
+}
+#endif
+
+static void UI_sampleStats (void)
+{
+	Watchdog_StatsType loopStats;
+	FanControl_StatsType fanStats;
+
+	Watchdog_getStats (&loopStats);
+	FanControl_getStats (&fanStats);
+
+	g_statsSnapshot[0] = WATCHDOG_TICKS_TO_US (loopStats.maxPeriod) / 1000;
+	g_statsSnapshot[1] = StackMonitor_getHighWatermark ();
+	g_statsSnapshot[2] = fanStats.actuatorSkips;
+	g_statsSnapshot[3] = g_stats.fieldSkips;
+	g_lastStatsTick = SysTick_getTicks ();
+}
+
+static void UI_renderStats (void)
+{
+	if ((SysTick_getTicks () - g_lastStatsTick) >= SYS_TICK_MS_TO_TICKS (UI_STATS_REFRESH_MS))
+	{
+		UI_sampleStats ();
+	}
+	UI_drawNumber (0, 0, 10, 4, g_statsSnapshot[0]);
+	UI_drawNumber (1, 1, 10, 5, g_statsSnapshot[1]);
+	UI_drawNumber (2, 2, 10, 6, g_statsSnapshot[2]);
+	UI_drawNumber (3, 3, 10, 6, g_statsSnapshot[3]);
+}
+
+/*
+ * Description :
+ * Make the given page the current one, its rows are drawn one per update so a
+ * page change never holds the loop for a whole screen of slow LCD writes.
+ */
+static void UI_selectPage (UI_PageId page)
+{
+	uint8 i;
+
+	g_page = page;
+	g_pendingRows = UI_ALL_ROWS_MASK;
+	for (i = 0; i < UI_MAX_FIELDS_PER_PAGE; i++)
+	{
+		g_shownValues[i] = UI_NOT_DISPLAYED;
+	}
+	if (page == UI_PAGE_STATS)
+	{
+		UI_sampleStats ();
+	}
+}
+
+/*
+ * Description :
+ * Send one step of the LCD initialization then load one bar graph glyph per update,
+ * once the LCD had LCD_POWER_UP_MS to start. The page is drawn from scratch after.
+ */
+static void UI_bringUpDisplay (void)
+{
+	if ((SysTick_getTicks () < SYS_TICK_MS_TO_TICKS (LCD_POWER_UP_MS)) || (!LCD_initStep ()) || (!BarGraph_initStep ()))
+	{
+		return;
+	}
+	g_displayReady = TRUE;
+	UI_selectPage (g_page);
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Select the status page and set the LCD pins, the LCD initialization and the
+ * glyph loading are spread over the next updates so the boot never waits for them.
+ */
+void UI_init (void)
+{
+	g_displayReady = FALSE;
+	LCD_startInit ();
+	UI_selectPage (UI_PAGE_STATUS);
+}
+
+/*
+ * Description :
+ * Apply a button press: NEXT selects the following page, UP and DOWN act on the
+ * current page (clear the temperature history, change the minimum fan speed or
+ * start and stop the auto-tuning).
+ */
+void UI_handleButton (Buttons_IdType button)
+{
+	uint8 minSpeed = FanControl_getMinSpeed ();
+	uint8 i;
+
+	if (button == BUTTON_NEXT)
+	{
+		UI_selectPage ((g_page + 1 < UI_NUM_OF_PAGES) ? (UI_PageId)(g_page + 1) : UI_PAGE_STATUS);
+		return;
+	}
+
+	switch (g_page)
+	{
+	case UI_PAGE_HISTORY:
+		/* Blank the rows, the values come back as the new samples arrive */
+		TempHistory_clear (TEMP_HISTORY_CONTROL_CHANNEL);
+		g_pendingRows |= UI_HISTORY_ROWS_MASK;
+		for (i = 0; i < UI_MAX_FIELDS_PER_PAGE; i++)
+		{
+			g_shownValues[i] = UI_NOT_DISPLAYED;
+		}
+		break;
+	case UI_PAGE_SETTINGS:
+		if (button == BUTTON_UP)
+		{
+			FanControl_setMinSpeed ((minSpeed + UI_MIN_SPEED_STEP > DC_MAX_SPEED) ? DC_MAX_SPEED : minSpeed + UI_MIN_SPEED_STEP);
+		}
+		else
+		{
+			FanControl_setMinSpeed ((minSpeed < UI_MIN_SPEED_STEP) ? DC_MIN_SPEED : minSpeed - UI_MIN_SPEED_STEP);
+		}
+		break;
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	case UI_PAGE_TUNE:
+		if (button == BUTTON_UP)
+		{
+			Autotune_start (FanControl_getSetpoint ());
+		}
+		else
+		{
+			Autotune_abort ();
+		}
+		break;
+#endif
+	default:
+		break;
+	}
+}
+
+/*
+ * Description :
+ * Called once every loop iteration with the latest temperature and fan speed:
+ * 1. Until the display is up, send its next initialization step and return.
+ * 2. After a page change, draw the fixed text of one row of the new page.
+ * 3. Redraw only the fields of the current page whose value changed.
+ */
+void UI_update (uint8 temperature, uint8 speed)
+{
+	if (!g_displayReady)
+	{
+		UI_bringUpDisplay ();
+		return;
+	}
+	if (g_pendingRows != 0)
+	{
+		UI_drawPendingRow ();
+	}
+
+	switch (g_page)
+	{
+	case UI_PAGE_STATUS:
+		UI_renderStatus (temperature, speed);
+		break;
+	case UI_PAGE_HISTORY:
+		UI_renderHistory ();
+		break;
+	case UI_PAGE_SETTINGS:
+		UI_renderSettings ();
+		break;
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	case UI_PAGE_TUNE:
+		UI_renderTune ();
+		break;
+#endif
+	case UI_PAGE_STATS:
+		UI_renderStats ();
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+ * Description :
+ * Copy the counters of the LCD writes done and skipped by the interface.
+ */
+void UI_getStats (UI_StatsType * Stats_Ptr)
+{
+	*Stats_Ptr = g_stats;
+}
@@ -0,0 +1,93 @@
+/******************************************************************************
+ *
+ * Module: UI
+ *
+ * File Name: ui.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the multi-page LCD user interface driven by the buttons
+ *
+ *******************************************************************************/
+
+#ifndef UI_H_
+#define UI_H_
+
+#include "std_types.h"
+#include "buttons.h"
+#include "fan_control.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define UI_STATS_REFRESH_MS                      1000
+#define UI_MIN_SPEED_STEP                        25
+
+/* Parameters Definitions */
+#define UI_NUM_OF_ROWS                           4
+#define UI_ROW_LENGTH                            16
+#define UI_MAX_FIELDS_PER_PAGE                   6
+#define UI_MAX_FIELD_WIDTH                       6
+#define UI_NOT_DISPLAYED                         0xFFFFFFFFUL
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+/* The tuned gains are only used by the PID mode, the curve mode has no TUNE page */
+typedef enum
+{
+	UI_PAGE_STATUS, UI_PAGE_HISTORY, UI_PAGE_SETTINGS,
+#if (FAN_CONTROL_MODE == FAN_CONTROL_MODE_PID)
+	UI_PAGE_TUNE,
+#endif
+	UI_PAGE_STATS, UI_NUM_OF_PAGES
+} UI_PageId;
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	uint32 fieldWrites;                /* Fields sent to the LCD */
+	uint32 fieldSkips;                 /* Fields left untouched as their value did not change */
+	uint16 rowWrites;                  /* Fixed page rows drawn after a page change */
+} UI_StatsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Select the status page and set the LCD pins, the LCD initialization and the
+ * glyph loading are spread over the next updates so the boot never waits for them.
+ */
+void UI_init (void);
+
+/*
+ * Description :
+ * Apply a button press: NEXT selects the following page, UP and DOWN act on the
+ * current page (clear the temperature history, change the minimum fan speed or
+ * start and stop the auto-tuning).
+ */
+void UI_handleButton (Buttons_IdType button);
+
+/*
+ * Description :
+ * Called once every loop iteration with the latest temperature and fan speed:
+ * 1. Until the display is up, send its next initialization step and return.
+ * 2. After a page change, draw the fixed text of one row of the new page.
+ * 3. Redraw only the fields of the current page whose value changed.
+ */
+void UI_update (uint8 temperature, uint8 speed);
+
+/*
+ * Description :
+ * Copy the counters of the LCD writes done and skipped by the interface.
+ */
+void UI_getStats (UI_StatsType * Stats_Ptr);
+
+#endif /* UI_H_ */
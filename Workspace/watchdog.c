@@ -0,0 +1,214 @@
+/******************************************************************************
+ *
+ * Module: WATCHDOG
+ *
+ * File Name: watchdog.c
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Source file for the watchdog-backed control-loop deadline monitor
+ *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/wdt.h>
+#include <util/atomic.h>
+#include "common_macros.h"
+#include "watchdog.h"
+#include "timer.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define WATCHDOG_RESET_INFO_MAGIC                0xD1A6
+#define WATCHDOG_ALL_TASKS_MASK                  ((uint8)((1 << WATCHDOG_NUM_OF_TASKS) - 1))
+
+/* The hardware watchdog is only a backstop, it must be longer than the software deadline */
+#define WATCHDOG_HW_TIMEOUT                      WDTO_500MS
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Kept in .noinit so the C startup code does not clear it across a watchdog reset */
+static Watchdog_ResetInfoType g_resetRecord __attribute__((section(".noinit")));
+
+static Watchdog_ResetInfoType g_lastResetInfo = {0, 0, 0, 0};
+static bool g_lastResetWasMiss = FALSE;
+
+static volatile Watchdog_StatsType g_stats = {0, 0xFFFF, 0, 0};
+static volatile uint16 g_lastServiceTime = 0;
+static volatile uint8 g_checkInMask = 0;
+static volatile uint8 g_missedTasks = 0;       /* Tasks skipped in a loop iteration, waiting for the deadline */
+
+static void (*volatile g_callBackPtr)(void) = NULL_PTR;
+
+/* Free running Timer1, the deadline interrupt is enabled once the first deadline is set */
+static const Timer_ConfigType g_timerConfig = {
+	TIMER_NORMAL_MODE, TIMER_PRESCALER_OF (WATCHDOG_TIMER_PRESCALER), 0,
+	{WATCHDOG_DEADLINE_TICKS, 0}, {TIMER_OUTPUT_DISCONNECTED, TIMER_OUTPUT_DISCONNECTED},
+	TIMER_INTERRUPT (TIMER_EVENT_COMPARE_A), TIMER_CAPTURE_FALLING
+};
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Record the failure in the reset-persistent area, drive the outputs to the safe
+ * state then force a hardware watchdog reset with the shortest timeout.
+ * Only called from the deadline interrupt, the record is written once per reset.
+ */
+static void Watchdog_deadlineMissed (uint16 elapsed)
+{
+	cli();
+
+	/* The record was cleared at boot, the count goes on from the reset before if it was a miss too */
+	g_resetRecord.magic = WATCHDOG_RESET_INFO_MAGIC;
+	g_resetRecord.worstPeriod = (elapsed > g_stats.maxPeriod) ? elapsed : g_stats.maxPeriod;
+	g_resetRecord.missedTasks = (g_missedTasks != 0) ? g_missedTasks : ((uint8)(~g_checkInMask) & WATCHDOG_ALL_TASKS_MASK);
+	g_resetRecord.resetCount = (g_lastResetInfo.resetCount < 0xFF) ? (g_lastResetInfo.resetCount + 1) : 0xFF;
+
+	if (g_callBackPtr != NULL_PTR)
+	{
+		(*g_callBackPtr)();                    /* Put the fan in its safe full speed state */
+	}
+
+	wdt_enable (WDTO_15MS);
+	for (;;);                                  /* Wait for the reset */
+}
+
+/* Called from the Timer1 compare A interrupt, fires only if the loop did not re-arm the deadline in time */
+static void Watchdog_isr (void)
+{
+	Watchdog_deadlineMissed (Timer_getCount (TIMER1_ID) - g_lastServiceTime);
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * 1. Recover the reset information left by a previous missed deadline.
+ * 2. Start Timer1 as a free running time base with the deadline on compare A.
+ * 3. Enable the hardware watchdog as a backstop for the deadline monitor.
+ */
+void Watchdog_init (void)
+{
+	/* The record is only meaningful after a watchdog reset, other resets leave garbage in it */
+	if (BIT_IS_SET (MCUCSR, WDRF) && (g_resetRecord.magic == WATCHDOG_RESET_INFO_MAGIC))
+	{
+		g_lastResetInfo = g_resetRecord;
+		g_lastResetWasMiss = TRUE;
+	}
+	g_resetRecord.magic = 0;                   /* Read once, a later reset without a miss must not report it again */
+	MCUCSR &= ~(1 << WDRF);                    /* Clear the reset flag for the next boot */
+
+	g_lastServiceTime = 0;
+	g_checkInMask = 0;
+	g_missedTasks = 0;
+
+	/* Timer1 starts from zero with the first deadline measured from now */
+	Timer_setCallBack (TIMER1_ID, TIMER_EVENT_COMPARE_A, Watchdog_isr);
+	Timer_init (TIMER1_ID, &g_timerConfig);
+
+	wdt_enable (WATCHDOG_HW_TIMEOUT);
+}
+
+/*
+ * Description :
+ * Save the address of the function called to drive the outputs to a safe state
+ * when the loop deadline is missed, just before the watchdog resets the MCU.
+ */
+void Watchdog_setCallBack (void (*a_ptr)(void))
+{
+	g_callBackPtr = a_ptr;
+}
+
+/*
+ * Description :
+ * Mark the given task as alive for the current loop iteration.
+ */
+void Watchdog_checkIn (Watchdog_TaskId task)
+{
+	g_checkInMask |= (uint8)(1 << task);
+}
+
+/*
+ * Description :
+ * Called once at the end of every loop iteration:
+ * 1. Measure the loop period and update the worst case and jitter statistics.
+ * 2. If all the tasks checked in, re-arm the deadline and kick the hardware watchdog,
+ *    otherwise stop re-arming it so the deadline interrupt records the miss.
+ */
+void Watchdog_service (void)
+{
+	uint16 now;
+	uint16 period;
+
+	ATOMIC_BLOCK (ATOMIC_RESTORESTATE)
+	{
+		now = Timer_getCount (TIMER1_ID);
+	}
+	period = now - g_lastServiceTime;          /* Unsigned subtraction handles the timer wrap */
+
+	/* A task was skipped, the loop is not healthy: stop re-arming and let the deadline interrupt record it */
+	if ((g_checkInMask != WATCHDOG_ALL_TASKS_MASK) || (g_missedTasks != 0))
+	{
+		g_missedTasks |= (uint8)(~g_checkInMask) & WATCHDOG_ALL_TASKS_MASK;
+		g_checkInMask = 0;
+		return;
+	}
+
+	g_stats.lastPeriod = period;
+	if (period < g_stats.minPeriod)
+	{
+		g_stats.minPeriod = period;
+	}
+	if (period > g_stats.maxPeriod)
+	{
+		g_stats.maxPeriod = period;
+	}
+	g_stats.loopCount++;
+
+	/* Re-arm the deadline relative to this service point */
+	ATOMIC_BLOCK (ATOMIC_RESTORESTATE)
+	{
+		g_lastServiceTime = now;
+		Timer_setCompare (TIMER1_ID, TIMER_CHANNEL_A, now + WATCHDOG_DEADLINE_TICKS);
+	}
+
+	g_checkInMask = 0;
+	wdt_reset ();
+}
+
+/*
+ * Description :
+ * Copy the loop period statistics measured since the initialization.
+ */
+void Watchdog_getStats (Watchdog_StatsType * Stats_Ptr)
+{
+	ATOMIC_BLOCK (ATOMIC_RESTORESTATE)
+	{
+		Stats_Ptr -> lastPeriod = g_stats.lastPeriod;
+		Stats_Ptr -> minPeriod = g_stats.minPeriod;
+		Stats_Ptr -> maxPeriod = g_stats.maxPeriod;
+		Stats_Ptr -> loopCount = g_stats.loopCount;
+	}
+}
+
+/*
+ * Description :
+ * Copy the information recorded before the last deadline reset.
+ * Returns TRUE if the last reset was caused by a missed deadline.
+ */
+bool Watchdog_getResetInfo (Watchdog_ResetInfoType * Info_Ptr)
+{
+	*Info_Ptr = g_lastResetInfo;
+	return g_lastResetWasMiss;
+}
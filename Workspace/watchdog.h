@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Module: WATCHDOG
+ *
+ * File Name: watchdog.h
+ *
+ * Author: Mohamed Nasser
+ *
+ * Date Created: Oct 19, 2026
+ *
+ * Description: Header file for the watchdog-backed control-loop deadline monitor
+ *
+ *******************************************************************************/
+
+#ifndef WATCHDOG_H_
+#define WATCHDOG_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Static Configurations */
+#define WATCHDOG_LOOP_DEADLINE_MS                250
+#define WATCHDOG_TIMER_PRESCALER                 64
+
+/* Parameters Definitions */
+#define WATCHDOG_TICK_US                         ((WATCHDOG_TIMER_PRESCALER * 1000000UL) / F_CPU)
+#define WATCHDOG_DEADLINE_TICKS                  ((WATCHDOG_LOOP_DEADLINE_MS * 1000UL) / WATCHDOG_TICK_US)
+#define WATCHDOG_TICKS_TO_US(TICKS)              ((uint32)(TICKS) * WATCHDOG_TICK_US)
+
+#if ((WATCHDOG_TIMER_PRESCALER != 1) && (WATCHDOG_TIMER_PRESCALER != 8) && (WATCHDOG_TIMER_PRESCALER != 64) && \
+	(WATCHDOG_TIMER_PRESCALER != 256) && (WATCHDOG_TIMER_PRESCALER != 1024))
+#error "The monitor timer prescaler does not exist on Timer1"
+#endif
+#if (WATCHDOG_DEADLINE_TICKS > 0xFFFF)
+#error "The loop deadline does not fit in the 16-bit monitor timer"
+#endif
+
+/*******************************************************************************
+ *                               Enumerations                                  *
+ *******************************************************************************/
+
+/* The critical tasks of the control loop, each one must check in every loop */
+typedef enum
+{
+	WATCHDOG_TASK_SENSE, WATCHDOG_TASK_CONTROL, WATCHDOG_TASK_DISPLAY, WATCHDOG_NUM_OF_TASKS
+} Watchdog_TaskId;
+
+/*******************************************************************************
+ *                      Structures And Unions                                  *
+ *******************************************************************************/
+typedef struct{
+	uint16 lastPeriod;                 /* Last loop period in monitor ticks */
+	uint16 minPeriod;                  /* Best case loop period in monitor ticks */
+	uint16 maxPeriod;                  /* Worst case loop period in monitor ticks */
+	uint32 loopCount;
+} Watchdog_StatsType;
+
+typedef struct{
+	uint16 magic;
+	uint16 worstPeriod;                /* Worst case loop latency in monitor ticks before the reset */
+	uint8 missedTasks;                 /* Bit mask of the tasks which did not check in */
+	uint8 resetCount;                  /* Number of consecutive deadline resets */
+} Watchdog_ResetInfoType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * 1. Recover the reset information left by a previous missed deadline.
+ * 2. Start Timer1 as a free running time base with the deadline on compare A.
+ * 3. Enable the hardware watchdog as a backstop for the deadline monitor.
+ */
+void Watchdog_init (void);
+
+/*
+ * Description :
+ * Save the address of the function called to drive the outputs to a safe state
+ * when the loop deadline is missed, just before the watchdog resets the MCU.
+ */
+void Watchdog_setCallBack (void (*a_ptr)(void));
+
+/*
+ * Description :
+ * Mark the given task as alive for the current loop iteration.
+ */
+void Watchdog_checkIn (Watchdog_TaskId task);
+
+/*
+ * Description :
+ * Called once at the end of every loop iteration:
+ * 1. Measure the loop period and update the worst case and jitter statistics.
+ * 2. If all the tasks checked in, re-arm the deadline and kick the hardware watchdog,
+ *    otherwise stop re-arming it so the deadline interrupt records the miss.
+ */
+void Watchdog_service (void);
+
+/*
+ * Description :
+ * Copy the loop period statistics measured since the initialization.
+ */
+void Watchdog_getStats (Watchdog_StatsType * Stats_Ptr);
+
+/*
+ * Description :
+ * Copy the information recorded before the last deadline reset.
+ * Returns TRUE if the last reset was caused by a missed deadline.
+ */
+bool Watchdog_getResetInfo (Watchdog_ResetInfoType * Info_Ptr);
+
+#endif /* WATCHDOG_H_ */